@@ -0,0 +1,199 @@
+#include "branch_reduce.h"
+#include <algorithm>
+
+BranchReduce::BranchReduce(int n, const std::vector<std::vector<int>> &adj)
+    : n(n), W((n + 64) / 64), filas((size_t)(n + 1) * W, 0), cota_abierta(0),
+      cota(0), cortado(false), num_nodos(0) {
+  for (int v = 1; v <= n; v++)
+    for (int u : adj[v])
+      if (u >= 1 && u <= n && u != v) {
+        filas[(size_t)v * W + u / 64] |= 1ULL << (u % 64);
+        filas[(size_t)u * W + v / 64] |= 1ULL << (v % 64);
+      }
+}
+
+int BranchReduce::grado(int v, const uint64_t *P) const {
+  const uint64_t *A = fila(v);
+  int g = 0;
+  for (int w = 0; w < W; w++)
+    g += __builtin_popcountll(A[w] & P[w]);
+  return g;
+}
+
+// agrega v a la solucion y saca N[v] de los candidatos
+void BranchReduce::tomar(int v, uint64_t *P) {
+  actual.push_back(v);
+  const uint64_t *A = fila(v);
+  for (int w = 0; w < W; w++)
+    P[w] &= ~A[w];
+  P[v / 64] &= ~(1ULL << (v % 64));
+}
+
+/*
+Pasadas sobre P hasta que ninguna regla se dispara. La ultima pasada (sin
+cambios) deja los grados exactos de G[P], de ahi salen el nodo de
+ramificacion y la cantidad de aristas para la cota de grados.
+*/
+void BranchReduce::reducir(uint64_t *P, int &vmax, long &m) {
+  bool cambio = true;
+  while (cambio) {
+    cambio = false;
+    vmax = -1;
+    m = 0;
+    int gmax = -1;
+    for (int w = 0; w < W; w++) {
+      uint64_t bits = P[w];
+      while (bits) {
+        int v = w * 64 + __builtin_ctzll(bits);
+        bits &= bits - 1;
+        if (!(P[w] >> (v % 64) & 1))
+          continue; // ya lo saco una reduccion de esta pasada
+        int g = grado(v, P);
+        if (g <= 1) {
+          tomar(v, P);
+          cambio = true;
+        } else if (g == 2) {
+          const uint64_t *A = fila(v);
+          int a = -1, b = -1;
+          for (int i = 0; i < W && b == -1; i++) {
+            uint64_t x = A[i] & P[i];
+            while (x && b == -1) {
+              int u = i * 64 + __builtin_ctzll(x);
+              x &= x - 1;
+              (a == -1 ? a : b) = u;
+            }
+          }
+          if (fila(a)[b / 64] >> (b % 64) & 1) {
+            tomar(v, P);
+            cambio = true;
+          }
+        }
+        if (!cambio) {
+          m += g;
+          if (g > gmax) {
+            gmax = g;
+            vmax = v;
+          }
+        }
+      }
+    }
+  }
+  m /= 2;
+}
+
+// particion greedy de P en cliques: alpha(G[P]) <= cantidad de cliques
+int BranchReduce::coberturaCliques(const uint64_t *P) const {
+  std::vector<uint64_t> R(P, P + W), cand(W);
+  int cliques = 0;
+  for (int w = 0; w < W; w++) {
+    while (R[w]) {
+      // la clique parte del primer nodo libre y agrega siempre el primer
+      // candidato adyacente a todos sus miembros
+      int v = w * 64 + __builtin_ctzll(R[w]);
+      cliques++;
+      for (int i = 0; i < W; i++)
+        cand[i] = R[i];
+      while (v != -1) {
+        R[v / 64] &= ~(1ULL << (v % 64));
+        const uint64_t *A = fila(v);
+        v = -1;
+        for (int i = 0; i < W; i++) {
+          cand[i] &= A[i];
+          if (v == -1 && cand[i])
+            v = i * 64 + __builtin_ctzll(cand[i]);
+        }
+      }
+    }
+  }
+  return cliques;
+}
+
+void BranchReduce::expandir(int d, int techo_padre) {
+  num_nodos++;
+  uint64_t *P = niveles[d].data();
+  size_t tam_actual = actual.size();
+
+  int vmax;
+  long m;
+  reducir(P, vmax, m);
+  if (actual.size() > mejor.size())
+    mejor = actual;
+  if (vmax == -1) {
+    actual.resize(tam_actual);
+    return;
+  }
+
+  int k = 0;
+  for (int w = 0; w < W; w++)
+    k += __builtin_popcountll(P[w]);
+  int gmax = grado(vmax, P);
+  int ub = k - (int)((m + gmax - 1) / gmax);
+  if ((int)actual.size() + ub > (int)mejor.size())
+    ub = std::min(ub, coberturaCliques(P));
+  // la cota del padre tambien vale aqui (la cobertura greedy no es monotona)
+  int techo = std::min(techo_padre, (int)actual.size() + ub);
+
+  if (techo <= (int)mejor.size()) {
+    actual.resize(tam_actual);
+    return;
+  }
+  // cada nodo cuesta O(|P| * W), mucho mas que leer el reloj
+  if (cortado || std::chrono::steady_clock::now() >= limite) {
+    cortado = true;
+    cota_abierta = std::max(cota_abierta, techo);
+    actual.resize(tam_actual);
+    return;
+  }
+
+  if ((int)niveles.size() <= d + 1)
+    niveles.emplace_back(W);
+  uint64_t *Q = niveles[d + 1].data();
+
+  // sin vmax
+  std::copy(P, P + W, Q);
+  Q[vmax / 64] &= ~(1ULL << (vmax % 64));
+  expandir(d + 1, techo);
+
+  // al cortar, la rama pendiente se evalua (reduccion + cota) para reportar
+  // una cota ajustada; pasado el margen queda acotada por la de este nodo
+  if (cortado && std::chrono::steady_clock::now() >= limite_margen) {
+    cota_abierta = std::max(cota_abierta, techo);
+    actual.resize(tam_actual);
+    return;
+  }
+
+  // con vmax (niveles pudo crecer: se vuelve a tomar el puntero)
+  P = niveles[d].data();
+  Q = niveles[d + 1].data();
+  std::copy(P, P + W, Q);
+  size_t antes = actual.size();
+  tomar(vmax, Q);
+  expandir(d + 1, techo);
+  actual.resize(antes);
+
+  actual.resize(tam_actual);
+}
+
+std::vector<int> BranchReduce::resolver(const std::vector<int> &inicial,
+                                        double limite_tiempo) {
+  auto ahora = std::chrono::steady_clock::now();
+  limite = ahora + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                       std::chrono::duration<double>(limite_tiempo));
+  limite_margen =
+      limite + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                   std::chrono::duration<double>(0.05 * limite_tiempo));
+  mejor = inicial;
+  actual.clear();
+  cortado = false;
+  cota_abierta = 0;
+  num_nodos = 0;
+
+  niveles.assign(1, std::vector<uint64_t>(W, 0));
+  for (int v = 1; v <= n; v++)
+    niveles[0][v / 64] |= 1ULL << (v % 64);
+  expandir(0, n);
+
+  cota = cortado ? std::max((int)mejor.size(), cota_abierta)
+                 : (int)mejor.size();
+  return mejor;
+}
@@ -0,0 +1,60 @@
+#ifndef BRANCH_REDUCE_H
+#define BRANCH_REDUCE_H
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+/*
+Branch & reduce exacto para el MISP sobre grafos chicos y medianos (pensado
+para el kernel de utils/Kernel). Los conjuntos de candidatos son bitsets
+sobre una matriz de adyacencia de bits. En cada nodo del arbol:
+  - reducciones: grado 0 y grado 1 se toman; grado 2 con vecinos adyacentes
+    (triangulo) se toma.
+  - cota superior: minimo entre una cobertura greedy con cliques (a lo mas
+    un nodo por clique) y la cota de grados |P| - ceil(m / grado_max).
+  - ramificacion sobre el nodo de grado maximo: primero sin el, luego con el.
+Con limite de tiempo, los nodos que quedan abiertos aportan su cota a la cota
+global, asi que al cortar se sigue reportando una cota valida. La cota de un
+hijo es a lo mas la de su padre.
+*/
+class BranchReduce {
+public:
+  // grafo con nodos 1..n (indice 0 se ignora)
+  BranchReduce(int n, const std::vector<std::vector<int>> &adj);
+
+  // busca hasta limite_tiempo segundos partiendo de la solucion inicial
+  // (cota inferior). Devuelve la mejor solucion encontrada
+  std::vector<int> resolver(const std::vector<int> &inicial,
+                            double limite_tiempo);
+
+  int cotaSuperior() const { return cota; } // cota de alpha(G)
+  bool optimo() const { return !cortado; }
+  long nodos() const { return num_nodos; }
+
+private:
+  int n, W;
+  std::vector<uint64_t> filas; // filas de adyacencia ((n + 1) * W)
+
+  std::vector<int> actual, mejor; // solucion en construccion y mejor
+  int cota_abierta; // mayor cota de los nodos que quedaron sin explorar
+  int cota;
+  bool cortado;
+  long num_nodos;
+  std::chrono::steady_clock::time_point limite;
+  // hasta aqui se evaluan las ramas pendientes tras el corte (5% extra)
+  std::chrono::steady_clock::time_point limite_margen;
+  std::vector<std::vector<uint64_t>> niveles; // candidatos por profundidad
+
+  const uint64_t *fila(int v) const { return &filas[(size_t)v * W]; }
+  int grado(int v, const uint64_t *P) const;
+  void tomar(int v, uint64_t *P);
+  // aplica las reducciones sobre P; deja en vmax el nodo de grado maximo
+  // (-1 si P queda vacio) y en m las aristas de G[P]
+  void reducir(uint64_t *P, int &vmax, long &m);
+  int coberturaCliques(const uint64_t *P) const;
+  // techo_padre: cota (tamaño total) del nodo padre
+  void expandir(int d, int techo_padre);
+};
+
+#endif
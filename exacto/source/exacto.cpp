@@ -0,0 +1,133 @@
+/*
+Compilar:
+make            (dentro de exacto/source)
+
+Ejecutar:
+./exacto -i <instancia-problema> [-t <segundos>] [-dense <densidad>] [-header]
+
+  -t: tiempo limite en segundos (por defecto 10)
+  -dense: desde esta densidad de la instancia se usa la clique maxima del
+      complemento (utils/MaxClique) en vez del branch & reduce (por defecto
+      0.65, 0 = nunca)
+  -header: imprime antes la cabecera del CSV
+
+Reduce el grafo con utils/Kernel, parte de la solucion de reducing-peeling
+sobre el kernel y ejecuta el branch & reduce (branch_reduce.h), o la clique
+maxima del complemento si la instancia es densa, hasta probar optimalidad o
+agotar el tiempo. Imprime una fila CSV:
+
+  N,Densidad,Instancia,Mejor,Cota,Optimo,Gap,Tiempo
+
+Mejor es el tamaño de la mejor solucion, Cota una cota superior de alpha(G),
+Optimo 1 si se probo optimalidad y Gap = (Cota - Mejor) / Mejor. N y Densidad
+siguen el formato de comparacion_algoritmos.csv para poder unir los gaps.
+
+Ejemplo de ejecución:
+./exacto -i ../../metaheuristica_hibrida/tuning/Instances/erdos_n1000_p0c0.9_0.graph -t 10 -header
+*/
+
+#include "branch_reduce.h"
+#include "utils/GraphReader.h"
+#include "utils/Kernel.h"
+#include "utils/MaxClique.h"
+#include "utils/ReducingPeeling.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+int main(int argc, char *argv[]) {
+
+  if (argc < 3 || std::string(argv[1]) != "-i") {
+    std::cerr << "Uso: ./exacto -i <instancia> [-t <segundos>] "
+                 "[-dense <densidad>] [-header]\n";
+    return 1;
+  }
+
+  std::string filename = argv[2];
+  double limite = 10.0;
+  double dense = 0.65;
+  bool header = false;
+  for (int a = 3; a < argc; a++) {
+    std::string arg = argv[a];
+    if (arg == "-t" && a + 1 < argc)
+      limite = std::stod(argv[++a]);
+    else if (arg == "-dense" && a + 1 < argc)
+      dense = std::stod(argv[++a]);
+    else if (arg == "-header")
+      header = true;
+  }
+
+  int V;
+  std::vector<std::vector<int>> adj;
+  if (!GraphReader::loadFromFile(filename, V, adj)) {
+    std::cerr << "Error loading the graph from the file." << std::endl;
+    return 1;
+  }
+
+  auto inicio = std::chrono::steady_clock::now();
+
+  // densidad sobre los nodos del archivo (ids 0..V-1), la misma que usan los
+  // otros motores para elegir la clique maxima
+  double densidad = MaxClique::density(V, adj);
+
+  // El branch & reduce trabaja sobre el kernel; los nodos fijados se suman
+  // a la solucion y a la cota
+  Kernel kernel(V, adj);
+  std::vector<int> sol_kernel =
+      reducingPeeling(kernel.size(), kernel.graph());
+
+  double restante =
+      limite - std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                             inicio)
+                   .count();
+  restante = std::max(0.0, restante);
+
+  // en grafos densos el MIS es chico y el complemento ralo: clique maxima
+  int cota_kernel;
+  bool optimo;
+  long nodos;
+  std::string motor;
+  if (dense > 0 && densidad >= dense) {
+    MaxClique mc(kernel.size(), kernel.graph());
+    sol_kernel = mc.solve(sol_kernel, restante);
+    cota_kernel = mc.bound();
+    optimo = mc.optimal();
+    nodos = mc.nodes();
+    motor = "clique";
+  } else {
+    BranchReduce br(kernel.size(), kernel.graph());
+    sol_kernel = br.resolver(sol_kernel, restante);
+    cota_kernel = br.cotaSuperior();
+    optimo = br.optimo();
+    nodos = br.nodos();
+    motor = "br";
+  }
+  std::vector<int> solucion = kernel.lift(sol_kernel);
+
+  double tiempo =
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio)
+          .count();
+
+  int mejor = solucion.size();
+  int cota = cota_kernel + kernel.offset();
+  double gap = mejor > 0 ? (double)(cota - mejor) / mejor : 0.0;
+
+  // a dos decimales, como en comparacion_algoritmos.csv
+  densidad = std::round(densidad * 100) / 100;
+
+  std::string instancia = filename.substr(filename.find_last_of('/') + 1);
+
+  std::cerr << "# exacto motor=" << motor << " kernel=" << kernel.size()
+            << " fixed=" << kernel.offset() << " nodos=" << nodos
+            << " t=" << tiempo << "\n";
+  if (header)
+    std::cout << "N,Densidad,Instancia,Mejor,Cota,Optimo,Gap,Tiempo\n";
+  std::cout << V << "," << densidad << "," << instancia << "," << mejor << ","
+            << cota << "," << (optimo ? 1 : 0) << "," << gap << ","
+            << tiempo << "\n";
+
+  return 0;
+}
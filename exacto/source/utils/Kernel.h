@@ -0,0 +1,89 @@
+#ifndef KERNEL_H
+#define KERNEL_H
+
+#include <cstdint>
+#include <vector>
+
+/*
+Kernelization for the maximum independent set problem. The reductions are
+applied until none of them fires:
+  - degree 0 / degree 1: the vertex belongs to some maximum independent set.
+  - degree 2: if the two neighbours are adjacent the vertex is taken,
+    otherwise the vertex and its neighbours are folded into a new vertex.
+  - twin: two non-adjacent degree-3 vertices with the same neighbourhood.
+    If the neighbourhood has an edge both twins are taken, otherwise the
+    five vertices are folded into a new vertex.
+  - isolated clique: N(v) is a clique, so v is taken.
+  - domination: u ~ v and N[v] is a subset of N[u], so u is dropped.
+
+Vertices are 1..n and index 0 is ignored, as in the rest of the solvers.
+The kernel is renumbered 1..size(). Every take/fold is recorded in a
+reconstruction log, and lift() maps an independent set of the kernel back to
+an independent set of the original graph with offset() more vertices.
+*/
+class Kernel {
+public:
+  Kernel(int n, const std::vector<std::vector<int>> &adj);
+
+  // reduced graph, vertices 1..size()
+  const std::vector<std::vector<int>> &graph() const { return kernelAdj; }
+  int size() const { return (int)kernelAdj.size() - 1; }
+  long edges() const;
+
+  // vertices fixed by the reductions (|lift(S)| = |S| + offset())
+  int offset() const { return base; }
+
+  // reduction time in seconds
+  double seconds() const { return elapsed; }
+
+  // independent set of the kernel -> independent set of the original graph
+  std::vector<int> lift(const std::vector<int> &kernelSolution) const;
+
+private:
+  enum StepType { TAKE, FOLD, TWIN_FOLD };
+  // TAKE: {v}; FOLD: {v, u, w, new}; TWIN_FOLD: {v, u, a, b, c, new}
+  struct Step {
+    StepType type;
+    int v[6];
+  };
+
+  int n;
+  int next; // first unused internal id (folds create new vertices)
+  std::vector<std::vector<int>> g; // adjacency, may still list dead vertices
+  std::vector<char> alive;
+  std::vector<int> deg; // alive neighbours
+
+  // adjacency bit matrix, only for graphs small enough to afford it
+  bool useMatrix;
+  int W;
+  std::vector<uint64_t> rows;
+  std::vector<uint64_t> aliveBits;
+
+  std::vector<int> pending;
+  std::vector<char> queued;
+  std::vector<int> mark;
+  int stamp;
+
+  std::vector<Step> log;
+  int base;
+  double elapsed;
+
+  std::vector<std::vector<int>> kernelAdj;
+  std::vector<int> toInternal; // kernel id -> internal id
+
+  void push(int v);
+  void compact(int v);
+  bool adjacent(int a, int b) const;
+  void removeVertex(int v);
+  void take(int v);
+  int newVertex(const std::vector<int> &nbrs);
+  std::vector<int> unionOfNeighbourhoods(const std::vector<int> &vs);
+
+  bool reduce(int v);
+  bool foldDegree2(int v);
+  bool twin(int v);
+  bool isolatedClique(int v);
+  bool dominates(int v);
+};
+
+#endif
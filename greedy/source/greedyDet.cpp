@@ -3,28 +3,152 @@ Compilar:
 g++ -std=c++17 <fuente> <dependencias> -o <greedyDet>
 
 Ejecutar:
-<greedyDet> -i <instancia-problema>
+<greedyDet> -i <instancia-problema> [-k] [-peel] [-ub]
+
+  -k: reduce the graph first (utils/Kernel) and run the greedy on the kernel.
+      Kernel size and reduction time are printed to stderr.
+  -peel: use the reducing-peeling heuristic (utils/ReducingPeeling) instead
+      of the static degree order.
+  -ub: compute an upper bound on the optimum (utils/UpperBound) and print it
+      to stderr with whether the solution is provably optimal.
+
+<greedyDet> -batch <manifest> [-o <salida.csv>]
+
+  Runs every job of the manifest (lines "<instancia> <semilla> [flags]",
+  see utils/Batch.h) loading each graph once, and writes one CSV row per
+  job. The seed is ignored: the greedy is deterministic.
 
 Ejemplo de compilación:
-g++ -std=c++17 greedy/source/greedyDet.cpp greedy/source/utils/GraphReader.cpp -o greedy/testing/greedyDet
+g++ -std=c++17 greedy/source/greedyDet.cpp greedy/source/utils/GraphReader.cpp greedy/source/utils/Kernel.cpp greedy/source/utils/ReducingPeeling.cpp greedy/source/utils/UpperBound.cpp greedy/source/utils/Batch.cpp -o greedy/testing/greedyDet
 
 Ejemplo de ejecución:
 ./greedy/testing/greedyDet -i greedy/testing/small_graph.graph
 */
 
 
+#include "utils/Batch.h"
 #include "utils/GraphReader.h"
+#include "utils/Kernel.h"
+#include "utils/ReducingPeeling.h"
+#include "utils/UpperBound.h"
 #include <algorithm>
 #include <chrono>
 #include <iostream>
+#include <memory>
 #include <string>
 #include <vector>
 
+// Flags accepted after the instance (also the parameters of a batch job)
+struct Options {
+  bool kernelize = false, peel = false, bound = false;
+};
+
+bool parseOptions(const std::vector<std::string> &args, Options &opt) {
+  for (const std::string &flag : args) {
+    if (flag == "-k")
+      opt.kernelize = true;
+    else if (flag == "-peel")
+      opt.peel = true;
+    else if (flag == "-ub")
+      opt.bound = true;
+    else
+      return false;
+  }
+  return true;
+}
+
+// Runs the greedy on a loaded graph; elapsed gets the reported time
+std::vector<int> solve(int V, std::vector<std::vector<int>> adj,
+                       const Options &opt, double &elapsed) {
+  // Optional kernelization: the greedy runs on the reduced graph
+  std::unique_ptr<Kernel> kernel;
+  if (opt.kernelize) {
+    kernel.reset(new Kernel(V, adj));
+    std::cerr << "# kernel n=" << V << " k=" << kernel->size()
+              << " m=" << kernel->edges() << " fixed=" << kernel->offset()
+              << " t=" << kernel->seconds() << "\n";
+    adj = kernel->graph();
+    V = kernel->size();
+  }
+
+  std::vector<int> independentSet;
+  auto start = std::chrono::high_resolution_clock::now();
+
+  if (opt.peel) {
+    // --- Reducing-peeling ---
+    independentSet = reducingPeeling(V, adj);
+  } else {
+    // --- Greedy Algorithm ---
+
+    // Step 1: Get the degrees of each node
+    std::vector<std::pair<int, int>> degrees(V + 1);
+    for (int i = 0; i <= V; i++) {
+      degrees[i] = {adj[i].size(), i}; // {degree, index}
+    }
+
+    // Step 2: Sort the nodes by degree (ascending)
+    std::sort(degrees.begin(), degrees.end());
+
+    // Step 3: Node selection
+    std::vector<bool> marked(V + 1, 0);
+
+    for (const auto &par : degrees) {
+      int node = par.second;
+      if (node == 0)
+        continue; // Ignore index 0
+      if (!marked[node]) {
+        independentSet.push_back(node);
+        marked[node] = true;
+        for (const auto &neighbor : adj[node])
+          marked[neighbor] = true;
+      }
+    }
+  }
+
+  auto end = std::chrono::high_resolution_clock::now();
+  elapsed = std::chrono::duration<double>(end - start).count();
+  if (kernel)
+    elapsed += kernel->seconds();
+
+  // Upper bound on the (kernel) graph, outside the reported time
+  if (opt.bound) {
+    UpperBound ub(V, adj);
+    int fixed = kernel ? kernel->offset() : 0;
+    std::cerr << "# bound ub=" << ub.value() + fixed
+              << " optimal=" << ((int)independentSet.size() >= ub.value())
+              << " t=" << ub.seconds() << "\n";
+  }
+
+  // Lift the kernel solution back to the original graph
+  if (kernel) {
+    independentSet = kernel->lift(independentSet);
+  }
+  return independentSet;
+}
+
 int main(int argc, char *argv[]) {
 
+  // Batch mode: every job of the manifest in this process
+  if (argc >= 2 && std::string(argv[1]) == "-batch") {
+    return Batch::main(argc, argv, 1,
+                       [](int V, const std::vector<std::vector<int>> &adj,
+                          const BatchJob &job, int &value) {
+                         Options opt;
+                         if (!parseOptions(job.params, opt))
+                           return false;
+                         double elapsed;
+                         value = solve(V, adj, opt, elapsed).size();
+                         return true;
+                       });
+  }
+
   // Graph reading:
-  if (argc != 3 || std::string(argv[1]) != "-i") {
-    std::cerr << "Usage: <Greedy> -i <problem-instance>\n";
+  Options opt;
+  bool validArgs = argc >= 3 && std::string(argv[1]) == "-i" &&
+                   parseOptions({argv + 3, argv + argc}, opt);
+  if (!validArgs) {
+    std::cerr << "Usage: <Greedy> -i <problem-instance> [-k] [-peel] [-ub]\n"
+                 "       <Greedy> -batch <manifest> [-o <output.csv>]\n";
     return 1;
   }
 
@@ -37,41 +161,12 @@ int main(int argc, char *argv[]) {
     return 1;
   }
 
-  // --- Greedy Algorithm ---
-  
-  // Step 1: Get the degrees of each node
-  std::vector<std::pair<int, int>> degrees(V + 1);
-  for (int i = 0; i <= V; i++) {
-    degrees[i] = {adj[i].size(), i}; // {degree, index}
-  }
-
-  // Step 2: Sort the nodes by degree (ascending)
-  std::sort(degrees.begin(), degrees.end());
-
-  // Step 3: Node selection
-  std::vector<int> independentSet;
-  std::vector<bool> marked(V + 1, 0);
-
-  auto start = std::chrono::high_resolution_clock::now();
-
-  for (const auto &par : degrees) {
-    int node = par.second;
-    if (node == 0)
-      continue; // Ignore index 0
-    if (!marked[node]) {
-      independentSet.push_back(node);
-      marked[node] = true;
-      for (const auto &neighbor : adj[node])
-        marked[neighbor] = true;
-    }
-  }
-
-  auto end = std::chrono::high_resolution_clock::now();
-  std::chrono::duration<double> elapsed = end - start;
+  double elapsed;
+  std::vector<int> independentSet = solve(V, std::move(adj), opt, elapsed);
 
   std::cout << independentSet.size()
-            << "\n";                    // Objective value (solution quality)
-  std::cout << elapsed.count() << "\n"; // Time used
+            << "\n";              // Objective value (solution quality)
+  std::cout << elapsed << "\n"; // Time used
 
   return 0;
 }
\ No newline at end of file
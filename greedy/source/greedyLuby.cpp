@@ -0,0 +1,154 @@
+/*
+Compilar:
+g++ -std=c++17 -O3 -pthread <fuente> <dependencias> -o <greedyLuby>
+
+Ejecutar:
+<greedyLuby> -i <instancia-problema> [-seed <semilla>] [-threads <hilos>]
+
+  -seed: seed of the random priorities (default 1). The solution depends
+      only on the seed, never on the number of threads.
+  -threads: worker threads (default: hardware concurrency).
+
+Parallel maximal independent set by random priorities over a CSR graph. A
+random permutation ranks the vertices; in every round an undecided vertex
+joins the set when all its higher-priority neighbours are out, and leaves
+when a neighbour is in. Each round reads the states of the previous one and
+every thread writes only the vertices of its own chunk, so no atomics are
+needed and the result is exactly the sequential greedy in priority order.
+Rounds are printed to stderr.
+
+Ejemplo de compilación:
+g++ -std=c++17 -O3 -pthread greedy/source/greedyLuby.cpp greedy/source/utils/CSRGraph.cpp -o greedy/testing/greedyLuby
+
+Ejemplo de ejecución:
+./greedy/testing/greedyLuby -i greedy/testing/small_graph.graph -seed 3
+*/
+
+#include "utils/CSRGraph.h"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+enum State : char { UNDECIDED, IN, OUT };
+
+// runs body(t, begin, end) over [0, count) split in one chunk per thread
+template <typename Body>
+void parallelFor(int threads, size_t count, const Body &body) {
+  if (threads <= 1 || count < 4096) {
+    body(0, 0, count);
+    return;
+  }
+  std::vector<std::thread> pool;
+  size_t chunk = (count + threads - 1) / threads;
+  for (int t = 0; t < threads; t++) {
+    size_t begin = std::min(count, t * chunk);
+    size_t end = std::min(count, begin + chunk);
+    pool.emplace_back([&body, t, begin, end]() { body(t, begin, end); });
+  }
+  for (auto &th : pool)
+    th.join();
+}
+
+int main(int argc, char *argv[]) {
+
+  // Graph reading:
+  if (argc < 3 || std::string(argv[1]) != "-i") {
+    std::cerr << "Usage: <greedyLuby> -i <problem-instance> [-seed <seed>] "
+                 "[-threads <threads>]\n";
+    return 1;
+  }
+
+  std::string filename = argv[2];
+  unsigned int seed = 1;
+  int threads = std::max(1u, std::thread::hardware_concurrency());
+  for (int a = 3; a + 1 < argc; a += 2) {
+    std::string flag = argv[a];
+    if (flag == "-seed")
+      seed = std::stoul(argv[a + 1]);
+    else if (flag == "-threads")
+      threads = std::max(1, std::stoi(argv[a + 1]));
+  }
+
+  CSRGraph g;
+  if (!CSRGraph::loadFromFile(filename, g)) {
+    std::cerr << "Error loading the graph from the file." << std::endl;
+    return 1;
+  }
+  int V = g.n;
+
+  auto start = std::chrono::high_resolution_clock::now();
+
+  // Random priorities: rank[v] < rank[u] means v goes first
+  std::vector<int> rank(V + 1);
+  std::iota(rank.begin(), rank.end(), 0);
+  std::mt19937 rng(seed);
+  std::shuffle(rank.begin() + 1, rank.end(), rng);
+
+  std::vector<char> state(V + 1, UNDECIDED), next(V + 1, UNDECIDED);
+  state[0] = OUT; // index 0 is ignored
+  std::vector<int> active(V);
+  std::iota(active.begin(), active.end(), 1);
+  std::vector<std::vector<int>> survivors(threads);
+
+  int rounds = 0;
+  while (!active.empty()) {
+    rounds++;
+
+    // Phase 1: decide from the previous round's states
+    parallelFor(threads, active.size(), [&](int, size_t b, size_t e) {
+      for (size_t i = b; i < e; i++) {
+        int v = active[i];
+        bool first = true, covered = false;
+        for (long long k = g.offsets[v]; k < g.offsets[v + 1]; k++) {
+          int u = g.targets[k];
+          if (state[u] == IN) {
+            covered = true;
+            break;
+          }
+          if (state[u] == UNDECIDED && rank[u] < rank[v])
+            first = false;
+        }
+        next[v] = covered ? OUT : (first ? IN : UNDECIDED);
+      }
+    });
+
+    // Phase 2: commit and keep the undecided vertices, in chunk order
+    parallelFor(threads, active.size(), [&](int t, size_t b, size_t e) {
+      survivors[t].clear();
+      for (size_t i = b; i < e; i++) {
+        int v = active[i];
+        state[v] = next[v];
+        if (state[v] == UNDECIDED)
+          survivors[t].push_back(v);
+      }
+    });
+    size_t kept = 0;
+    for (auto &s : survivors) {
+      std::copy(s.begin(), s.end(), active.begin() + kept);
+      kept += s.size();
+      s.clear();
+    }
+    active.resize(kept);
+  }
+
+  std::vector<int> independentSet;
+  for (int v = 1; v <= V; v++)
+    if (state[v] == IN)
+      independentSet.push_back(v);
+
+  auto end = std::chrono::high_resolution_clock::now();
+  std::chrono::duration<double> elapsed = end - start;
+
+  std::cerr << "# luby n=" << V << " m=" << g.edges() << " rounds=" << rounds
+            << " threads=" << threads << "\n";
+  std::cout << independentSet.size()
+            << "\n";                    // Objective value (solution quality)
+  std::cout << elapsed.count() << "\n"; // Time used
+
+  return 0;
+}
@@ -3,42 +3,55 @@ Compilar:
 g++ -std=c++17 <fuente> <dependencias> -o <greedyRand>
 
 Ejecutar:
-<greedyRand> -i <instancia-problema> <Longitud-RCL>
+<greedyRand> -i <instancia-problema> <Longitud-RCL> [-ub]
 
 donde <Longitud-RCL> corresponde al tamaño de la lista restringida de candidatos (k).
+  -ub: compute an upper bound on the optimum (utils/UpperBound) and print it
+      to stderr with whether the solution is provably optimal.
+
+<greedyRand> -batch <manifest> [-o <salida.csv>]
+
+  Runs every job of the manifest (lines "<instancia> <semilla> <Longitud-RCL>
+  [-ub]", see utils/Batch.h) loading each graph once, and writes one CSV row
+  per job. rand() is seeded with the seed of each job.
 
 Ejemplo de compilación:
-g++ -std=c++17 greedy/source/greedyRand.cpp greedy/source/utils/GraphReader.cpp -o greedy/testing/greedyRand
+g++ -std=c++17 greedy/source/greedyRand.cpp greedy/source/utils/GraphReader.cpp greedy/source/utils/UpperBound.cpp greedy/source/utils/Batch.cpp -o greedy/testing/greedyRand
 
 Ejemplo de ejecución:
 ./greedy/testing/greedyRand -i greedy/testing/small_graph.graph 3
 */
 
+#include "utils/Batch.h"
 #include "utils/GraphReader.h"
+#include "utils/UpperBound.h"
 #include <algorithm>
 #include <chrono>
+#include <cstdlib>
 #include <iostream>
 #include <string>
 #include <vector>
 
-int main(int argc, char *argv[]) {
-
-  // Graph reading:
-  if (argc < 4 || std::string(argv[1]) != "-i") {
-    std::cerr << "Usage: <Greedy-probabilista> -i <instancia-problema> "
-                 "[parámetros-adicionales]\n";
-    return 1;
-  }
-
-  std::string filename = argv[2];
-  int k = std::stoi(argv[3]);
-  int V;
-  std::vector<std::vector<int>> adj;
-
-  if (!GraphReader::loadFromFile(filename, V, adj)) {
-    std::cerr << "Error loading the graph from the file." << std::endl;
-    return 1;
-  }
+// Parameters after the instance (also the parameters of a batch job):
+// <Longitud-RCL> [-ub]
+struct Options {
+  int k = 0;
+  bool bound = false;
+};
+
+bool parseOptions(const std::vector<std::string> &args, Options &opt) {
+  if (args.empty() || args.size() > 2 || (args.size() == 2 && args[1] != "-ub"))
+    return false;
+  opt.k = std::stoi(args[0]);
+  opt.bound = args.size() == 2;
+  return opt.k > 0;
+}
+
+// Runs the randomized greedy on a loaded graph (rand() must be seeded by the
+// caller); elapsed gets the reported time
+std::vector<int> solve(int V, const std::vector<std::vector<int>> &adj,
+                       const Options &opt, double &elapsed) {
+  int k = opt.k;
 
   // --- Randomized Greedy Algorithm ---
 
@@ -93,10 +106,61 @@ int main(int argc, char *argv[]) {
   }
 
   auto end = std::chrono::high_resolution_clock::now();
-  std::chrono::duration<double> elapsed = end - start;
+  elapsed = std::chrono::duration<double>(end - start).count();
+
+  // Upper bound, outside the reported time
+  if (opt.bound) {
+    UpperBound ub(V, adj);
+    std::cerr << "# bound ub=" << ub.value()
+              << " optimal=" << ((int)independentSet.size() >= ub.value())
+              << " t=" << ub.seconds() << "\n";
+  }
+  return independentSet;
+}
+
+int main(int argc, char *argv[]) {
+
+  // Batch mode: every job of the manifest in this process, rand() seeded
+  // with the seed of each job
+  if (argc >= 2 && std::string(argv[1]) == "-batch") {
+    return Batch::main(argc, argv, 1,
+                       [](int V, const std::vector<std::vector<int>> &adj,
+                          const BatchJob &job, int &value) {
+                         Options opt;
+                         if (!parseOptions(job.params, opt))
+                           return false;
+                         srand(job.seed);
+                         double elapsed;
+                         value = solve(V, adj, opt, elapsed).size();
+                         return true;
+                       });
+  }
+
+  // Graph reading:
+  Options opt;
+  if (argc < 4 || std::string(argv[1]) != "-i" ||
+      !parseOptions({argv + 3, argv + argc}, opt)) {
+    std::cerr << "Usage: <Greedy-probabilista> -i <instancia-problema> "
+                 "[parámetros-adicionales]\n"
+                 "       <Greedy-probabilista> -batch <manifest> "
+                 "[-o <output.csv>]\n";
+    return 1;
+  }
+
+  std::string filename = argv[2];
+  int V;
+  std::vector<std::vector<int>> adj;
+
+  if (!GraphReader::loadFromFile(filename, V, adj)) {
+    std::cerr << "Error loading the graph from the file." << std::endl;
+    return 1;
+  }
+
+  double elapsed;
+  std::vector<int> independentSet = solve(V, adj, opt, elapsed);
 
   std::cout << independentSet.size()
-            << "\n";                    // Objective value (solution quality)
-  std::cout << elapsed.count() << "\n"; // Time used
+            << "\n";              // Objective value (solution quality)
+  std::cout << elapsed << "\n"; // Time used
   return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,52 @@
+#ifndef BATCH_H
+#define BATCH_H
+
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/*
+Batch mode shared by the drivers. A manifest lists one job per line,
+
+    <instance> <seed> [driver parameters...]
+
+where the parameters are the ones the driver takes on its command line
+without -i (blank lines and text after '#' are ignored). Jobs are grouped
+by instance in order of first appearance: each graph is read once, every
+job on it runs in the same process, and the graph is released before the
+next instance is loaded. One CSV row per job is written to the output:
+
+    Instancia,Semilla,Parametros,Valor,Tiempo
+
+Tiempo is the wall time of the job alone (graph loading is reported once
+per instance on stderr).
+*/
+struct BatchJob {
+  std::string instance;
+  unsigned int seed;
+  std::vector<std::string> params;
+  int line; // manifest line, for error messages
+};
+
+// Runs one job on an already loaded graph and stores the size of its
+// solution in value. Returns false (or throws) when the job is invalid.
+using BatchRunner =
+    std::function<bool(int n, const std::vector<std::vector<int>> &adj,
+                       const BatchJob &job, int &value)>;
+
+class Batch {
+public:
+  static bool readManifest(const std::string &filename,
+                           std::vector<BatchJob> &jobs);
+  // Returns the number of failed jobs (unreadable graph, invalid
+  // parameters); their rows are left out of the CSV.
+  static int run(const std::vector<BatchJob> &jobs, std::ostream &out,
+                 const BatchRunner &runner);
+  // -batch <manifest> [-o <output.csv>] from argv[first...]; output goes to
+  // stdout without -o. Returns the process exit code.
+  static int main(int argc, char *argv[], int first,
+                  const BatchRunner &runner);
+};
+
+#endif
@@ -0,0 +1,67 @@
+#include "CSRGraph.h"
+#include <cstdio>
+#include <iostream>
+
+namespace {
+
+// next non-negative integer in [p, end), false at the end of the buffer
+bool nextInt(const char *&p, const char *end, long long &x) {
+  while (p < end && (*p < '0' || *p > '9'))
+    p++;
+  if (p == end)
+    return false;
+  x = 0;
+  while (p < end && *p >= '0' && *p <= '9')
+    x = x * 10 + (*p++ - '0');
+  return true;
+}
+
+} // namespace
+
+bool CSRGraph::loadFromFile(const std::string &filename, CSRGraph &g) {
+  FILE *f = std::fopen(filename.c_str(), "rb");
+  if (!f) {
+    std::cerr << "Error: no se pudo abrir el archivo " << filename << "\n";
+    return false;
+  }
+  std::fseek(f, 0, SEEK_END);
+  long size = std::ftell(f);
+  std::fseek(f, 0, SEEK_SET);
+  std::vector<char> buffer(size > 0 ? size : 0);
+  size_t read = std::fread(buffer.data(), 1, buffer.size(), f);
+  std::fclose(f);
+
+  const char *p = buffer.data(), *end = buffer.data() + read;
+  long long x;
+  if (!nextInt(p, end, x)) {
+    std::cerr << "Error: archivo vacio " << filename << "\n";
+    return false;
+  }
+  g.n = (int)x;
+
+  // first pass: edge list and degrees
+  std::vector<int> edgeList;
+  std::vector<long long> deg(g.n + 2, 0);
+  long long u, v;
+  while (nextInt(p, end, u) && nextInt(p, end, v)) {
+    if (u == v || u > g.n || v > g.n)
+      continue;
+    edgeList.push_back((int)u);
+    edgeList.push_back((int)v);
+    deg[u]++;
+    deg[v]++;
+  }
+
+  // second pass: prefix sums and fill
+  g.offsets.assign(g.n + 2, 0);
+  for (int w = 0; w <= g.n; w++)
+    g.offsets[w + 1] = g.offsets[w] + deg[w];
+  g.targets.resize(g.offsets[g.n + 1]);
+  std::vector<long long> pos(g.offsets.begin(), g.offsets.end() - 1);
+  for (size_t e = 0; e < edgeList.size(); e += 2) {
+    int a = edgeList[e], b = edgeList[e + 1];
+    g.targets[pos[a]++] = b;
+    g.targets[pos[b]++] = a;
+  }
+  return true;
+}
@@ -0,0 +1,25 @@
+#ifndef CSRGRAPH_H
+#define CSRGRAPH_H
+
+#include <string>
+#include <vector>
+
+/*
+Compressed sparse row graph for instances too large for vector-of-vectors
+adjacency. Neighbours of v are targets[offsets[v] .. offsets[v + 1]).
+Vertices are 0..n as in GraphReader (the solvers ignore index 0); self loops
+are dropped and every edge is stored in both directions.
+*/
+struct CSRGraph {
+  int n = 0;
+  std::vector<long long> offsets; // size n + 2
+  std::vector<int> targets;
+
+  int degree(int v) const { return (int)(offsets[v + 1] - offsets[v]); }
+  long long edges() const { return (long long)targets.size() / 2; }
+
+  // same file format as GraphReader::loadFromFile, parsed from one buffer
+  static bool loadFromFile(const std::string &filename, CSRGraph &g);
+};
+
+#endif
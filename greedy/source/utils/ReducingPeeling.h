@@ -0,0 +1,19 @@
+#ifndef REDUCINGPEELING_H
+#define REDUCINGPEELING_H
+
+#include <vector>
+
+/*
+Reducing-peeling heuristic for the maximum independent set (in the spirit
+of Chang, Li and Zhang's LinearTime/NearLinear). Degree-0 and degree-1
+vertices are taken, degree-2 vertices are taken (triangle) or folded, and
+when no reduction applies the vertex of maximum degree is peeled (removed
+without taking it). Degrees are kept in lazy bucket queues, so the whole run
+is near-linear in the size of the graph. Folds are undone at the end and the
+solution is extended to a maximal one.
+
+Vertices are 1..n and index 0 is ignored, as in the rest of the solvers.
+*/
+std::vector<int> reducingPeeling(int n, const std::vector<std::vector<int>> &adj);
+
+#endif
@@ -0,0 +1,81 @@
+#include "UpperBound.h"
+#include <algorithm>
+#include <chrono>
+
+namespace {
+
+// greedy clique cover following order; returns the number of cliques
+int coverCliques(int n, const std::vector<std::vector<int>> &adj,
+                 const std::vector<int> &order) {
+  std::vector<char> covered(n + 1, 0);
+  std::vector<int> count(n + 1, 0); // members adjacent to each vertex
+  std::vector<int> seen(n + 1, 0);  // last member that counted the vertex
+  std::vector<int> touched;
+  int stamp = 0, cliques = 0;
+
+  for (int v : order) {
+    if (covered[v])
+      continue;
+    cliques++;
+    int size = 0;
+    auto add = [&](int u) {
+      covered[u] = 1;
+      size++;
+      stamp++;
+      for (int x : adj[u])
+        if (x >= 1 && x <= n && seen[x] != stamp) {
+          seen[x] = stamp; // duplicated edges count once
+          if (count[x]++ == 0)
+            touched.push_back(x);
+        }
+    };
+    add(v);
+    for (int u : adj[v])
+      if (u >= 1 && u <= n && !covered[u] && count[u] == size)
+        add(u);
+    for (int x : touched)
+      count[x] = 0;
+    touched.clear();
+  }
+  return cliques;
+}
+
+} // namespace
+
+UpperBound::UpperBound(int n, const std::vector<std::vector<int>> &adj,
+                       bool refine) {
+  auto start = std::chrono::steady_clock::now();
+
+  // degrees without self loops or repeated edges
+  std::vector<int> deg(n + 1, 0), seen(n + 1, 0);
+  long long m = 0;
+  int maxDeg = 0;
+  for (int v = 1; v <= n; v++) {
+    for (int u : adj[v])
+      if (u >= 1 && u <= n && u != v && seen[u] != v) {
+        seen[u] = v;
+        deg[v]++;
+      }
+    m += deg[v];
+    maxDeg = std::max(maxDeg, deg[v]);
+  }
+  m /= 2;
+  degree = maxDeg == 0 ? n : n - (int)((m + maxDeg - 1) / maxDeg);
+
+  // dense vertices first: they tend to sit in the larger cliques
+  std::vector<int> order(n);
+  for (int v = 1; v <= n; v++)
+    order[v - 1] = v;
+  std::stable_sort(order.begin(), order.end(),
+                   [&](int a, int b) { return deg[a] > deg[b]; });
+  cover = coverCliques(n, adj, order);
+  if (refine) {
+    std::reverse(order.begin(), order.end());
+    cover = std::min(cover, coverCliques(n, adj, order));
+  }
+
+  bound = std::min(cover, degree);
+  elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                          start)
+                .count();
+}
@@ -3,11 +3,25 @@ Compilar:
 g++ -std=c++17 <fuente> <dependencias> -o <meta_sa>
 
 Ejecutar:
-<meta_sa> -i <instancia-problema> <T_inicial> <alpha>
+<meta_sa> -i <instancia-problema> <T_inicial> <alpha> [-k] [-peel]
 
 donde:
   <T_inicial>: Temperatura inicial del Simulated Annealing
   <alpha>: Factor de enfriamiento (0 < alpha < 1)
+  -k: reduce the graph first (utils/Kernel) and anneal on the kernel; the
+      reduction time counts against the 10 s budget
+  -peel: start from the reducing-peeling solution (utils/ReducingPeeling)
+      instead of the deterministic greedy
+
+<meta_sa> -batch <manifest> [-o <salida.csv>]
+
+  Runs every job of the manifest (lines "<instancia> <semilla> <T_inicial>
+  <alpha> [-k] [-peel]", see utils/Batch.h) loading each graph once, and
+  writes one CSV row per job with the best size. The random generators are
+  seeded with the seed of each job and the improvement lines are not printed.
+
+The search stops before the 10 s when the best solution reaches the upper
+bound of utils/UpperBound (provably optimal); the bound goes to stderr.
 
 Parámetros recomendados según tamaño del grafo:
   n = 1000: T_inicial = 1000, alpha = 0.9993
@@ -15,7 +29,7 @@ Parámetros recomendados según tamaño del grafo:
   n = 3000: T_inicial = 3000, alpha = 0.9996
 
 Ejemplo de compilación:
-g++ -std=c++17 metaheuristica/source/meta_sa.cpp metaheuristica/source/utils/GraphReader.cpp -o metaheuristica/testing/meta_sa
+g++ -std=c++17 metaheuristica/source/meta_sa.cpp metaheuristica/source/utils/GraphReader.cpp metaheuristica/source/utils/Kernel.cpp metaheuristica/source/utils/ReducingPeeling.cpp metaheuristica/source/utils/UpperBound.cpp metaheuristica/source/utils/Batch.cpp -o metaheuristica/testing/meta_sa
 
 Ejemplos de ejecución:
 # Grafo pequeño (test)
@@ -28,12 +42,17 @@ Ejemplos de ejecución:
 ./metaheuristica/testing/meta_sa -i dataset_grafos_no_dirigidos/new_2000_dataset/erdos_n2000_p0c0.1_1.graph 2000 0.9995
 */
 
+#include "utils/Batch.h"
 #include "utils/GraphReader.h"
+#include "utils/Kernel.h"
+#include "utils/ReducingPeeling.h"
+#include "utils/UpperBound.h"
 #include <algorithm>
 #include <chrono>
 #include <cmath>
 #include <cstdlib>
 #include <iostream>
+#include <memory>
 #include <random>
 #include <string>
 #include <vector>
@@ -134,31 +153,53 @@ std::vector<int> greedyDet(int V, const std::vector<std::vector<int>> &adj) {
   return independentSet;
 }
 
-int main(int argc, char *argv[]) {
-
-  // Graph reading:
-  if (argc < 5 || std::string(argv[1]) != "-i") {
-    std::cerr << "Usage: <meta_sa> -i <instancia-problema> "
-                 "<temperatura-inicial> <alpha>\n";
-    return 1;
-  }
-
-  std::string filename = argv[2];
-  double initial_temp = std::stod(argv[3]);
-  double alpha = std::stod(argv[4]);
-  int V;
-  std::vector<std::vector<int>> adj;
-
-  if (!GraphReader::loadFromFile(filename, V, adj)) {
-    std::cerr << "Error loading the graph from the file." << std::endl;
-    return 1;
+// Parameters after the instance (also the parameters of a batch job):
+// <T_inicial> <alpha> [-k] [-peel]
+struct Options {
+  double initial_temp = 0, alpha = 0;
+  bool kernelize = false, peel = false;
+};
+
+bool parseOptions(const std::vector<std::string> &args, Options &opt) {
+  if (args.size() < 2)
+    return false;
+  opt.initial_temp = std::stod(args[0]);
+  opt.alpha = std::stod(args[1]);
+  for (size_t a = 2; a < args.size(); a++) {
+    if (args[a] == "-k")
+      opt.kernelize = true;
+    else if (args[a] == "-peel")
+      opt.peel = true;
   }
+  return true;
+}
 
+// Anneals on a loaded graph with gen seeded by seed. Every improvement is
+// written to progress as "<size> <time>" (nullptr = silent); the best size
+// and the time it was found are returned.
+std::pair<int, double> solve(int V, std::vector<std::vector<int>> adj,
+                             const Options &opt, unsigned int seed,
+                             std::ostream *progress) {
   auto start_time = std::chrono::steady_clock::now();
   const double time_limit_seconds = 10.0;
 
+  // Optional kernelization: SA runs on the reduced graph and every reported
+  // size adds the vertices fixed by the reductions
+  std::unique_ptr<Kernel> kernel;
+  int fixed = 0;
+  if (opt.kernelize) {
+    kernel.reset(new Kernel(V, adj));
+    std::cerr << "# kernel n=" << V << " k=" << kernel->size()
+              << " m=" << kernel->edges() << " fixed=" << kernel->offset()
+              << " t=" << kernel->seconds() << "\n";
+    adj = kernel->graph();
+    V = kernel->size();
+    fixed = kernel->offset();
+  }
+
   // --- Simulated Annealing Algorithm ---
-  std::vector<int> actual_solution = greedyDet(V, adj);
+  std::vector<int> actual_solution =
+      opt.peel ? reducingPeeling(V, adj) : greedyDet(V, adj);
   std::vector<int> best_solution = actual_solution;
   std::vector<int> greedy_solution = actual_solution;
 
@@ -166,20 +207,27 @@ int main(int argc, char *argv[]) {
   double time_best_solution_found =
       std::chrono::duration<double>(greedy_time_point - start_time).count();
 
-  std::cout << best_solution.size() << " " << time_best_solution_found
-            << std::endl;
+  if (progress)
+    *progress << best_solution.size() + fixed << " "
+              << time_best_solution_found << std::endl;
 
-  double temp = initial_temp;
+  // Early termination: no solution can beat the upper bound
+  UpperBound ub(V, adj);
+  std::cerr << "# bound ub=" << ub.value() + fixed << " t=" << ub.seconds()
+            << "\n";
+
+  double temp = opt.initial_temp;
+  double alpha = opt.alpha;
 
   // initialization of random number generator
-  std::random_device rd;
-  std::mt19937 gen(rd());
+  std::mt19937 gen(seed);
   std::uniform_real_distribution<> dis(0.0, 1.0);
 
-  // time condition (10 seconds)
-  while (std::chrono::duration<double>(std::chrono::steady_clock::now() -
+  // time condition (10 seconds); an empty kernel is already solved
+  while (V > 0 && (int)best_solution.size() < ub.value() &&
+         std::chrono::duration<double>(std::chrono::steady_clock::now() -
                                        start_time)
-             .count() < time_limit_seconds) {
+                 .count() < time_limit_seconds) {
 
     std::vector<int> S_prime =
         random_neighbor_solution(actual_solution, adj, V, gen);
@@ -197,9 +245,9 @@ int main(int argc, char *argv[]) {
       time_best_solution_found =
           std::chrono::duration<double>(now_point - start_time).count();
 
-      if (time_best_solution_found < time_limit_seconds) {
-        std::cout << best_solution.size() << " " << time_best_solution_found
-                  << std::endl;
+      if (progress && time_best_solution_found < time_limit_seconds) {
+        *progress << best_solution.size() + fixed << " "
+                  << time_best_solution_found << std::endl;
       }
     } else {
 
@@ -221,8 +269,53 @@ int main(int argc, char *argv[]) {
     temp *= alpha; // geometric cooling
   }
 
-  std::cout << best_solution.size() << " " << time_best_solution_found
-            << std::endl;
+  // Lift the kernel solution back to the original graph
+  if (kernel)
+    best_solution = kernel->lift(best_solution);
+
+  return {(int)best_solution.size(), time_best_solution_found};
+}
+
+int main(int argc, char *argv[]) {
+
+  // Batch mode: every job of the manifest in this process, gen and rand()
+  // seeded with the seed of each job
+  if (argc >= 2 && std::string(argv[1]) == "-batch") {
+    return Batch::main(argc, argv, 1,
+                       [](int V, const std::vector<std::vector<int>> &adj,
+                          const BatchJob &job, int &value) {
+                         Options opt;
+                         if (!parseOptions(job.params, opt))
+                           return false;
+                         srand(job.seed);
+                         value = solve(V, adj, opt, job.seed, nullptr).first;
+                         return true;
+                       });
+  }
+
+  // Graph reading:
+  if (argc < 5 || std::string(argv[1]) != "-i") {
+    std::cerr << "Usage: <meta_sa> -i <instancia-problema> "
+                 "<temperatura-inicial> <alpha> [-k] [-peel]\n"
+                 "       <meta_sa> -batch <manifest> [-o <output.csv>]\n";
+    return 1;
+  }
+
+  std::string filename = argv[2];
+  Options opt;
+  parseOptions({argv + 3, argv + argc}, opt);
+  int V;
+  std::vector<std::vector<int>> adj;
+
+  if (!GraphReader::loadFromFile(filename, V, adj)) {
+    std::cerr << "Error loading the graph from the file." << std::endl;
+    return 1;
+  }
+
+  std::random_device rd;
+  std::pair<int, double> best = solve(V, std::move(adj), opt, rd(), &std::cout);
+
+  std::cout << best.first << " " << best.second << std::endl;
 
   return 0;
 }
@@ -0,0 +1,135 @@
+#include "Batch.h"
+#include "GraphReader.h"
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+
+bool Batch::readManifest(const std::string &filename,
+                         std::vector<BatchJob> &jobs) {
+  std::ifstream in(filename);
+  if (!in) {
+    std::cerr << "Could not open the manifest " << filename << "\n";
+    return false;
+  }
+  std::string text;
+  for (int line = 1; std::getline(in, text); line++) {
+    size_t hash = text.find('#');
+    if (hash != std::string::npos)
+      text.erase(hash);
+    std::istringstream tokens(text);
+    BatchJob job;
+    std::string seed;
+    if (!(tokens >> job.instance))
+      continue; // blank or comment line
+    if (!(tokens >> seed)) {
+      std::cerr << "Manifest line " << line << ": missing seed\n";
+      return false;
+    }
+    try {
+      job.seed = std::stoul(seed);
+    } catch (const std::exception &) {
+      std::cerr << "Manifest line " << line << ": invalid seed " << seed
+                << "\n";
+      return false;
+    }
+    for (std::string p; tokens >> p;)
+      job.params.push_back(p);
+    job.line = line;
+    jobs.push_back(job);
+  }
+  return true;
+}
+
+int Batch::run(const std::vector<BatchJob> &jobs, std::ostream &out,
+               const BatchRunner &runner) {
+  // jobs grouped by instance, in order of first appearance
+  std::vector<std::vector<const BatchJob *>> groups;
+  std::unordered_map<std::string, int> group;
+  for (const BatchJob &job : jobs) {
+    auto it = group.emplace(job.instance, (int)groups.size()).first;
+    if (it->second == (int)groups.size())
+      groups.emplace_back();
+    groups[it->second].push_back(&job);
+  }
+
+  out << "Instancia,Semilla,Parametros,Valor,Tiempo\n";
+  int failed = 0;
+  for (const auto &g : groups) {
+    const std::string &instance = g.front()->instance;
+    auto t0 = std::chrono::steady_clock::now();
+    int n;
+    std::vector<std::vector<int>> adj;
+    if (!GraphReader::loadFromFile(instance, n, adj)) {
+      std::cerr << "Error loading the graph from the file " << instance
+                << "\n";
+      failed += g.size();
+      continue;
+    }
+    std::cerr << "# batch instance=" << instance << " n=" << n
+              << " jobs=" << g.size() << " load="
+              << std::chrono::duration<double>(
+                     std::chrono::steady_clock::now() - t0)
+                     .count()
+              << "\n";
+
+    for (const BatchJob *job : g) {
+      std::string params;
+      for (const std::string &p : job->params)
+        params += (params.empty() ? "" : " ") + p;
+      int value = 0;
+      bool ok = false;
+      auto start = std::chrono::steady_clock::now();
+      try {
+        ok = runner(n, adj, *job, value);
+      } catch (const std::exception &e) {
+        std::cerr << e.what() << "\n";
+      }
+      double elapsed = std::chrono::duration<double>(
+                           std::chrono::steady_clock::now() - start)
+                           .count();
+      if (!ok) {
+        std::cerr << "Manifest line " << job->line << ": job failed\n";
+        failed++;
+        continue;
+      }
+      out << instance << "," << job->seed << "," << params << "," << value
+          << "," << elapsed << "\n";
+      out.flush(); // a long campaign keeps the rows already finished
+    }
+  }
+  return failed;
+}
+
+int Batch::main(int argc, char *argv[], int first,
+                const BatchRunner &runner) {
+  std::string manifest, output;
+  for (int a = first; a < argc; a++) {
+    std::string flag = argv[a];
+    if (flag == "-batch" && a + 1 < argc)
+      manifest = argv[++a];
+    else if (flag == "-o" && a + 1 < argc)
+      output = argv[++a];
+    else {
+      std::cerr << "Usage: -batch <manifest> [-o <output.csv>]\n";
+      return 1;
+    }
+  }
+
+  std::vector<BatchJob> jobs;
+  if (manifest.empty() || !readManifest(manifest, jobs))
+    return 1;
+
+  std::ofstream file;
+  if (!output.empty()) {
+    file.open(output);
+    if (!file) {
+      std::cerr << "Could not open " << output << "\n";
+      return 1;
+    }
+  }
+  int failed = run(jobs, output.empty() ? std::cout : file, runner);
+  return failed == 0 ? 0 : 1;
+}
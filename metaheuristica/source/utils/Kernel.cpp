@@ -0,0 +1,335 @@
+#include "Kernel.h"
+#include <algorithm>
+#include <chrono>
+
+// largest internal id count that still uses the bit matrix (~32 MB)
+static const int MATRIX_LIMIT = 16384;
+// without the matrix, clique and domination checks only for low degree
+static const int LIST_LIMIT = 8;
+
+Kernel::Kernel(int n, const std::vector<std::vector<int>> &adj)
+    : n(n), next(n + 1), stamp(0), base(0) {
+  auto start = std::chrono::steady_clock::now();
+
+  // every fold removes at least three vertices and creates one
+  int cap = n + n / 2 + 2;
+  g.assign(cap, std::vector<int>());
+  alive.assign(cap, 0);
+  deg.assign(cap, 0);
+  queued.assign(cap, 0);
+  mark.assign(cap, 0);
+
+  for (int v = 1; v <= n; v++) {
+    for (int u : adj[v])
+      if (u >= 1 && u <= n && u != v)
+        g[v].push_back(u);
+    std::sort(g[v].begin(), g[v].end());
+    g[v].erase(std::unique(g[v].begin(), g[v].end()), g[v].end());
+    alive[v] = 1;
+    deg[v] = g[v].size();
+  }
+
+  useMatrix = cap <= MATRIX_LIMIT;
+  W = useMatrix ? (cap + 63) / 64 : 0;
+  if (useMatrix) {
+    rows.assign((size_t)cap * W, 0);
+    aliveBits.assign(W, 0);
+    for (int v = 1; v <= n; v++) {
+      aliveBits[v / 64] |= 1ULL << (v % 64);
+      for (int u : g[v])
+        rows[(size_t)v * W + u / 64] |= 1ULL << (u % 64);
+    }
+  }
+
+  for (int v = n; v >= 1; v--)
+    push(v);
+  while (!pending.empty()) {
+    int v = pending.back();
+    pending.pop_back();
+    queued[v] = 0;
+    reduce(v);
+  }
+
+  // renumber the surviving vertices 1..k
+  std::vector<int> toKernel(next, 0);
+  toInternal.assign(1, 0);
+  for (int v = 1; v < next; v++) {
+    if (alive[v]) {
+      toKernel[v] = toInternal.size();
+      toInternal.push_back(v);
+    }
+  }
+  kernelAdj.assign(toInternal.size(), std::vector<int>());
+  for (size_t k = 1; k < toInternal.size(); k++) {
+    int v = toInternal[k];
+    compact(v);
+    for (int u : g[v])
+      kernelAdj[k].push_back(toKernel[u]);
+  }
+
+  elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                          start)
+                .count();
+}
+
+long Kernel::edges() const {
+  long m = 0;
+  for (const auto &nbrs : kernelAdj)
+    m += nbrs.size();
+  return m / 2;
+}
+
+void Kernel::push(int v) {
+  if (alive[v] && !queued[v]) {
+    queued[v] = 1;
+    pending.push_back(v);
+  }
+}
+
+// drops dead vertices from the adjacency list of v
+void Kernel::compact(int v) {
+  if ((int)g[v].size() == deg[v])
+    return;
+  std::vector<int> &nbrs = g[v];
+  nbrs.erase(std::remove_if(nbrs.begin(), nbrs.end(),
+                            [&](int u) { return !alive[u]; }),
+             nbrs.end());
+}
+
+// a and b are alive; edges only disappear with their endpoints
+bool Kernel::adjacent(int a, int b) const {
+  if (useMatrix)
+    return rows[(size_t)a * W + b / 64] >> (b % 64) & 1;
+  if (g[a].size() > g[b].size())
+    std::swap(a, b);
+  return std::find(g[a].begin(), g[a].end(), b) != g[a].end();
+}
+
+void Kernel::removeVertex(int v) {
+  alive[v] = 0;
+  if (useMatrix)
+    aliveBits[v / 64] &= ~(1ULL << (v % 64));
+  for (int u : g[v]) {
+    if (alive[u]) {
+      deg[u]--;
+      push(u);
+    }
+  }
+}
+
+// v goes into the solution and its neighbourhood is deleted
+void Kernel::take(int v) {
+  log.push_back({TAKE, {v, 0, 0, 0, 0, 0}});
+  base++;
+  compact(v);
+  std::vector<int> nbrs = g[v];
+  for (int u : nbrs)
+    removeVertex(u);
+  removeVertex(v);
+}
+
+int Kernel::newVertex(const std::vector<int> &nbrs) {
+  int x = next++;
+  g[x] = nbrs;
+  alive[x] = 1;
+  deg[x] = nbrs.size();
+  if (useMatrix)
+    aliveBits[x / 64] |= 1ULL << (x % 64);
+  for (int u : nbrs) {
+    g[u].push_back(x);
+    deg[u]++;
+    if (useMatrix) {
+      rows[(size_t)x * W + u / 64] |= 1ULL << (u % 64);
+      rows[(size_t)u * W + x / 64] |= 1ULL << (x % 64);
+    }
+    push(u);
+  }
+  push(x);
+  return x;
+}
+
+// alive neighbours of vs, excluding vs themselves
+std::vector<int> Kernel::unionOfNeighbourhoods(const std::vector<int> &vs) {
+  stamp++;
+  for (int v : vs)
+    mark[v] = stamp;
+  std::vector<int> out;
+  for (int v : vs) {
+    compact(v);
+    for (int u : g[v]) {
+      if (mark[u] != stamp) {
+        mark[u] = stamp;
+        out.push_back(u);
+      }
+    }
+  }
+  return out;
+}
+
+bool Kernel::foldDegree2(int v) {
+  compact(v);
+  int u = g[v][0], w = g[v][1];
+  if (adjacent(u, w)) {
+    take(v);
+    return true;
+  }
+  std::vector<int> nbrs = unionOfNeighbourhoods({u, w});
+  nbrs.erase(std::remove(nbrs.begin(), nbrs.end(), v), nbrs.end());
+  removeVertex(v);
+  removeVertex(u);
+  removeVertex(w);
+  int x = newVertex(nbrs);
+  log.push_back({FOLD, {v, u, w, x, 0, 0}});
+  base++;
+  return true;
+}
+
+bool Kernel::twin(int v) {
+  compact(v);
+  int a = g[v][0], b = g[v][1], c = g[v][2];
+  stamp++;
+  mark[a] = mark[b] = mark[c] = stamp;
+
+  int u = -1;
+  compact(a);
+  for (int cand : g[a]) {
+    if (cand == v || deg[cand] != 3 || mark[cand] == stamp)
+      continue;
+    compact(cand);
+    if (mark[g[cand][0]] == stamp && mark[g[cand][1]] == stamp &&
+        mark[g[cand][2]] == stamp) {
+      u = cand;
+      break;
+    }
+  }
+  if (u == -1)
+    return false;
+
+  if (adjacent(a, b) || adjacent(a, c) || adjacent(b, c)) {
+    take(v);
+    take(u); // isolated after taking v
+    return true;
+  }
+  std::vector<int> nbrs = unionOfNeighbourhoods({a, b, c});
+  nbrs.erase(std::remove_if(nbrs.begin(), nbrs.end(),
+                            [&](int x) { return x == u || x == v; }),
+             nbrs.end());
+  for (int x : {v, u, a, b, c})
+    removeVertex(x);
+  int x = newVertex(nbrs);
+  log.push_back({TWIN_FOLD, {v, u, a, b, c, x}});
+  base += 2;
+  return true;
+}
+
+bool Kernel::isolatedClique(int v) {
+  compact(v);
+  if (useMatrix) {
+    const uint64_t *rv = &rows[(size_t)v * W];
+    for (int u : g[v]) {
+      const uint64_t *ru = &rows[(size_t)u * W];
+      // N[v] must be inside N[u]
+      for (int k = 0; k < W; k++) {
+        uint64_t missing = (rv[k] & aliveBits[k]) & ~ru[k];
+        if (k == u / 64)
+          missing &= ~(1ULL << (u % 64));
+        if (missing)
+          return false;
+      }
+    }
+  } else {
+    if (deg[v] > LIST_LIMIT)
+      return false;
+    for (size_t i = 0; i < g[v].size(); i++)
+      for (size_t j = i + 1; j < g[v].size(); j++)
+        if (!adjacent(g[v][i], g[v][j]))
+          return false;
+  }
+  take(v);
+  return true;
+}
+
+// removes every neighbour u of v with N[v] inside N[u]
+bool Kernel::dominates(int v) {
+  compact(v);
+  if (!useMatrix && deg[v] > LIST_LIMIT)
+    return false;
+  std::vector<int> nbrs = g[v];
+  bool changed = false;
+  for (int u : nbrs) {
+    if (!alive[u] || deg[u] < deg[v])
+      continue;
+    bool dominated = true;
+    if (useMatrix) {
+      const uint64_t *rv = &rows[(size_t)v * W];
+      const uint64_t *ru = &rows[(size_t)u * W];
+      for (int k = 0; k < W && dominated; k++) {
+        uint64_t missing = (rv[k] & aliveBits[k]) & ~ru[k];
+        if (k == u / 64)
+          missing &= ~(1ULL << (u % 64));
+        dominated = missing == 0;
+      }
+    } else {
+      for (int x : g[v])
+        if (x != u && alive[x] && !adjacent(u, x)) {
+          dominated = false;
+          break;
+        }
+    }
+    if (dominated) {
+      removeVertex(u);
+      changed = true;
+    }
+  }
+  return changed;
+}
+
+bool Kernel::reduce(int v) {
+  if (!alive[v])
+    return false;
+  if (deg[v] <= 1) {
+    take(v);
+    return true;
+  }
+  if (deg[v] == 2)
+    return foldDegree2(v);
+  if (deg[v] == 3 && twin(v))
+    return true;
+  if (isolatedClique(v))
+    return true;
+  return dominates(v);
+}
+
+std::vector<int> Kernel::lift(const std::vector<int> &kernelSolution) const {
+  std::vector<char> in(next, 0);
+  for (int k : kernelSolution)
+    in[toInternal[k]] = 1;
+
+  for (auto it = log.rbegin(); it != log.rend(); ++it) {
+    const Step &s = *it;
+    if (s.type == TAKE) {
+      in[s.v[0]] = 1;
+    } else if (s.type == FOLD) {
+      // new vertex in the solution -> both neighbours, otherwise the centre
+      if (in[s.v[3]]) {
+        in[s.v[3]] = 0;
+        in[s.v[1]] = in[s.v[2]] = 1;
+      } else {
+        in[s.v[0]] = 1;
+      }
+    } else {
+      if (in[s.v[5]]) {
+        in[s.v[5]] = 0;
+        in[s.v[2]] = in[s.v[3]] = in[s.v[4]] = 1;
+      } else {
+        in[s.v[0]] = in[s.v[1]] = 1;
+      }
+    }
+  }
+
+  std::vector<int> solution;
+  for (int v = 1; v <= n; v++)
+    if (in[v])
+      solution.push_back(v);
+  return solution;
+}
@@ -0,0 +1,187 @@
+#include "ReducingPeeling.h"
+#include <algorithm>
+
+namespace {
+
+struct Peeler {
+  std::vector<std::vector<int>> g; // adjacency, may still list dead vertices
+  std::vector<char> alive;
+  std::vector<int> deg;
+  std::vector<std::vector<int>> bucket; // lazy: entries checked on pop
+  std::vector<int> low;                 // candidates with degree <= 2
+  int maxDeg = 0;
+
+  // log of takes ({v, 0, 0, 0}) and folds ({v, u, w, new})
+  struct Step {
+    bool fold;
+    int v, u, w, x;
+  };
+  std::vector<Step> log;
+
+  void touch(int v) {
+    if ((int)bucket.size() <= deg[v])
+      bucket.resize(deg[v] + 1);
+    bucket[deg[v]].push_back(v);
+    maxDeg = std::max(maxDeg, deg[v]);
+    if (deg[v] <= 2)
+      low.push_back(v);
+  }
+
+  void compact(int v) {
+    if ((int)g[v].size() == deg[v])
+      return;
+    std::vector<int> &nbrs = g[v];
+    nbrs.erase(std::remove_if(nbrs.begin(), nbrs.end(),
+                              [&](int u) { return !alive[u]; }),
+               nbrs.end());
+  }
+
+  void removeVertex(int v) {
+    alive[v] = 0;
+    for (int u : g[v]) {
+      if (alive[u]) {
+        deg[u]--;
+        touch(u);
+      }
+    }
+  }
+
+  void take(int v) {
+    log.push_back({false, v, 0, 0, 0});
+    compact(v);
+    std::vector<int> nbrs = g[v];
+    for (int u : nbrs)
+      removeVertex(u);
+    removeVertex(v);
+  }
+
+  bool adjacent(int a, int b) const {
+    if (g[a].size() > g[b].size())
+      std::swap(a, b);
+    return std::find(g[a].begin(), g[a].end(), b) != g[a].end();
+  }
+
+  // v has degree 2 with neighbours u, w
+  void reduceDegree2(int v, std::vector<int> &mark, int &stamp) {
+    compact(v);
+    int u = g[v][0], w = g[v][1];
+    if (adjacent(u, w)) {
+      take(v);
+      return;
+    }
+    // fold v, u, w into a new vertex x with N(x) = N(u) + N(w) - {v}
+    compact(u);
+    compact(w);
+    stamp++;
+    mark[v] = mark[u] = mark[w] = stamp;
+    std::vector<int> nbrs;
+    for (int a : {u, w})
+      for (int y : g[a])
+        if (mark[y] != stamp) {
+          mark[y] = stamp;
+          nbrs.push_back(y);
+        }
+    removeVertex(v);
+    removeVertex(u);
+    removeVertex(w);
+
+    int x = g.size();
+    g.push_back(nbrs);
+    alive.push_back(1);
+    deg.push_back(nbrs.size());
+    mark.push_back(0);
+    for (int y : nbrs) {
+      g[y].push_back(x);
+      deg[y]++;
+      touch(y);
+    }
+    touch(x);
+    log.push_back({true, v, u, w, x});
+  }
+};
+
+} // namespace
+
+std::vector<int> reducingPeeling(int n,
+                                 const std::vector<std::vector<int>> &adj) {
+  Peeler P;
+  P.g.assign(n + 1, std::vector<int>());
+  P.alive.assign(n + 1, 0);
+  P.deg.assign(n + 1, 0);
+  P.bucket.assign(1, std::vector<int>()); // an empty graph still has degree 0
+  for (int v = 1; v <= n; v++) {
+    for (int u : adj[v])
+      if (u >= 1 && u <= n && u != v)
+        P.g[v].push_back(u);
+    std::sort(P.g[v].begin(), P.g[v].end());
+    P.g[v].erase(std::unique(P.g[v].begin(), P.g[v].end()), P.g[v].end());
+    P.alive[v] = 1;
+    P.deg[v] = P.g[v].size();
+  }
+  for (int v = 1; v <= n; v++)
+    P.touch(v);
+
+  std::vector<int> mark(n + 1, 0);
+  int stamp = 0;
+  while (true) {
+    // reductions first
+    if (!P.low.empty()) {
+      int v = P.low.back();
+      P.low.pop_back();
+      if (!P.alive[v] || P.deg[v] > 2)
+        continue;
+      if (P.deg[v] <= 1)
+        P.take(v);
+      else
+        P.reduceDegree2(v, mark, stamp);
+      continue;
+    }
+
+    // otherwise peel the vertex of maximum degree
+    int v = -1;
+    while (P.maxDeg >= 0 && v == -1) {
+      std::vector<int> &b = P.bucket[P.maxDeg];
+      while (!b.empty() && v == -1) {
+        int cand = b.back();
+        b.pop_back();
+        if (P.alive[cand] && P.deg[cand] == P.maxDeg)
+          v = cand;
+      }
+      if (v == -1)
+        P.maxDeg--;
+    }
+    if (v == -1)
+      break;
+    P.removeVertex(v);
+  }
+
+  // undo the folds in reverse order
+  std::vector<char> in(P.g.size(), 0);
+  for (auto it = P.log.rbegin(); it != P.log.rend(); ++it) {
+    if (!it->fold) {
+      in[it->v] = 1;
+    } else if (in[it->x]) {
+      in[it->x] = 0;
+      in[it->u] = in[it->w] = 1;
+    } else {
+      in[it->v] = 1;
+    }
+  }
+
+  // peeled vertices may leave room: extend to a maximal solution
+  std::vector<int> solution;
+  for (int v = 1; v <= n; v++) {
+    if (!in[v]) {
+      bool free = true;
+      for (int u : adj[v])
+        if (u >= 1 && u <= n && in[u]) {
+          free = false;
+          break;
+        }
+      in[v] = free;
+    }
+    if (in[v])
+      solution.push_back(v);
+  }
+  return solution;
+}
@@ -0,0 +1,35 @@
+#ifndef UPPERBOUND_H
+#define UPPERBOUND_H
+
+#include <vector>
+
+/*
+Cheap upper bounds on the independence number alpha(G), used to stop a
+solver as soon as its incumbent is provably optimal:
+  - clique cover: the vertices are partitioned greedily into cliques and an
+    independent set has at most one vertex per clique. Each clique grows
+    from its first uncovered vertex with the neighbours adjacent to every
+    member (kept with per-vertex counters, so the cover is O(n + m)).
+  - degree bound: every edge touches a vertex outside the independent set,
+    so m <= maxdeg * (n - alpha).
+With refine, a second cover is built over the reverse order (a different
+colouring of the complement) and the smaller one is kept.
+
+Vertices are 1..n and index 0 is ignored, as in the rest of the solvers.
+*/
+class UpperBound {
+public:
+  UpperBound(int n, const std::vector<std::vector<int>> &adj,
+             bool refine = true);
+
+  int value() const { return bound; } // min of the bounds below
+  int cliqueCover() const { return cover; }
+  int degreeBound() const { return degree; }
+  double seconds() const { return elapsed; }
+
+private:
+  int bound, cover, degree;
+  double elapsed;
+};
+
+#endif
@@ -10,6 +10,7 @@ OPTIMAL_PE=0.17
 OPTIMAL_PM=0.24
 OPTIMAL_RHOE=0.78
 OPTIMAL_TIME=10  # segundos
+OPTIMAL_DENSE=0  # 0 = siempre el BRKGA, nunca la clique máxima (-dense)
 
 # =============================================
 # RUTAS DEL CLUSTER
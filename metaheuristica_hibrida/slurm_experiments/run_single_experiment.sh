@@ -37,6 +37,9 @@ PE=0.17
 PM=0.24
 RHOE=0.78
 TIME=10
+# -dense 0: las instancias densas también los resuelve el BRKGA (no la clique máxima),
+# así los resultados siguen siendo comparables con los CSV anteriores
+DENSE=0
 
 # Información del job
 echo "========================================="
@@ -44,13 +47,13 @@ echo "Job ID: $SLURM_JOB_ID"
 echo "Nodo: $SLURM_NODELIST"
 echo "Instancia: $INSTANCE"
 echo "Seed: $SEED"
-echo "Parámetros: -p $POPULATION -pe $PE -pm $PM -rhoe $RHOE"
+echo "Parámetros: -p $POPULATION -pe $PE -pm $PM -rhoe $RHOE -dense $DENSE"
 echo "Tiempo: $TIME segundos"
 echo "========================================="
 echo ""
 
 # Ejecución del programa
-srun ${EXE} -i ${INSTANCE} -t ${TIME} -seed ${SEED} -p ${POPULATION} -pe ${PE} -pm ${PM} -rhoe ${RHOE}
+srun ${EXE} -i ${INSTANCE} -t ${TIME} -seed ${SEED} -p ${POPULATION} -pe ${PE} -pm ${PM} -rhoe ${RHOE} -dense ${DENSE}
 
 # Código de salida
 EXIT_CODE=$?
@@ -0,0 +1,285 @@
+/*
+Micro-benchmark de los caminos calientes del MISP
+
+Mide, sobre instancias fijas del dataset y grafos Erdos-Renyi generados con
+semilla fija:
+  carga          GraphReader::loadFromFile
+  greedyDet      greedy por grado (greedyRand con RCL de tamaño 1)
+  greedyRand     construccion aleatorizada con RCL de tamaño 10
+  sa.iter        una iteracion del SA corto del warm start
+  decoder        BRKGA::decoder de un individuo aleatorio
+  cruce          BRKGA::cruzar (sin evaluar al hijo)
+  mutante        BRKGA::mutante (sin evaluar)
+  subinstancia   solveSubInstance sobre una V' de 3 soluciones con un
+                 contexto nuevo: creacion del solver, modelo y un solve de
+                 1 ms (subinstancia.modelo es solo la preparacion del modelo)
+
+Cada caso se repite hasta superar -min segundos y se informa ns/op, op/s y
+las reservas de memoria (cantidad y bytes) por operacion, contadas con un
+operator new global.
+
+Uso:
+  ./brkga_bench [-dataset <dir>] [-min <segundos>] [-csv]
+*/
+
+#include "brkga_class.h"
+#include "subproblem_solver.h"
+#include "utils/GraphReader.h"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <new>
+#include <random>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+// --- Conteo de reservas de memoria ---
+static std::atomic<long> reservas{0}, bytes_reservados{0};
+
+void *operator new(std::size_t tam) {
+  reservas.fetch_add(1, std::memory_order_relaxed);
+  bytes_reservados.fetch_add(tam, std::memory_order_relaxed);
+  if (void *p = std::malloc(tam ? tam : 1))
+    return p;
+  throw std::bad_alloc();
+}
+void *operator new[](std::size_t tam) { return operator new(tam); }
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete[](void *p) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void *p, std::size_t) noexcept { std::free(p); }
+
+// acceso a los metodos privados del BRKGA (friend en brkga_class.h)
+struct AccesoBenchmark {
+  static std::vector<int> greedyRand(BRKGA &b, int k) {
+    return b.greedyRand(k);
+  }
+  static std::vector<int> saCorto(BRKGA &b, const std::vector<int> &inicial,
+                                  int iters) {
+    return b.saCorto(inicial, iters);
+  }
+  static Individuo mutante(BRKGA &b) { return b.mutante(); }
+  static Individuo cruzar(BRKGA &b, const Individuo &e, const Individuo &ne) {
+    return b.cruzar(e, ne);
+  }
+  // contexto nuevo con limite de 1 ms: se mide sobre todo el modelo
+  static double subinstancia(BRKGA &b, const std::vector<int> &vprime,
+                             const std::vector<int> &incumbente) {
+    b.contexto = crearSolver(b.nombre_solver, b.n, b.adj, 0.001);
+    b.solveSubInstance(vprime, incumbente);
+    return b.ultima_llamada.t_modelo;
+  }
+};
+
+namespace {
+
+double min_segundos = 0.2;
+bool salida_csv = false;
+
+struct Grafo {
+  std::string nombre, archivo;
+  int n = 0;
+  std::vector<std::vector<int>> adj;
+};
+
+// Erdos-Renyi G(n, p) con semilla fija, en el formato del dataset
+Grafo generarER(int n, double p, unsigned int semilla) {
+  Grafo g;
+  char nombre[64];
+  std::snprintf(nombre, sizeof(nombre), "er_n%d_p%.2f", n, p);
+  g.nombre = nombre;
+  g.n = n;
+  g.adj.assign(n + 1, {});
+  std::mt19937 rng(semilla);
+  std::bernoulli_distribution arista(p);
+  for (int u = 1; u <= n; u++)
+    for (int v = u + 1; v <= n; v++)
+      if (arista(rng)) {
+        g.adj[u].push_back(v);
+        g.adj[v].push_back(u);
+      }
+  return g;
+}
+
+// escribe g en un archivo temporal para medir la carga (ids 0-based)
+std::string escribirTemporal(const Grafo &g) {
+  char ruta[] = "/tmp/misp_benchXXXXXX";
+  int fd = mkstemp(ruta);
+  if (fd < 0)
+    return "";
+  close(fd);
+  std::ofstream out(ruta);
+  out << g.n << "\n";
+  for (int u = 1; u <= g.n; u++)
+    for (int v : g.adj[u])
+      if (u < v)
+        out << u - 1 << " " << v - 1 << "\n";
+  return ruta;
+}
+
+void imprimirCabecera() {
+  if (salida_csv)
+    std::printf("caso,grafo,ns_op,op_s,reservas_op,bytes_op\n");
+  else
+    std::printf("%-20s %-26s %14s %14s %12s %14s\n", "caso", "grafo",
+                "ns/op", "op/s", "reservas/op", "bytes/op");
+}
+
+// reservas_op < 0: sin conteo de reservas para el caso
+void imprimir(const std::string &caso, const std::string &grafo, double ns,
+              double reservas_op, double bytes_op) {
+  char res[32] = "", bytes[32] = "";
+  if (reservas_op >= 0) {
+    std::snprintf(res, sizeof(res), "%.2f", reservas_op);
+    std::snprintf(bytes, sizeof(bytes), "%.1f", bytes_op);
+  } else if (!salida_csv) {
+    std::snprintf(res, sizeof(res), "-");
+    std::snprintf(bytes, sizeof(bytes), "-");
+  }
+  if (salida_csv)
+    std::printf("%s,%s,%.1f,%.1f,%s,%s\n", caso.c_str(), grafo.c_str(), ns,
+                1e9 / ns, res, bytes);
+  else
+    std::printf("%-20s %-26s %14.1f %14.1f %12s %14s\n", caso.c_str(),
+                grafo.c_str(), ns, 1e9 / ns, res, bytes);
+  std::fflush(stdout);
+}
+
+/*
+Repite op en tandas que se duplican hasta superar min_segundos (despues de
+una ejecucion de calentamiento). unidades es la cantidad de operaciones que
+representa una llamada (ej. iteraciones del SA).
+*/
+void medir(const std::string &caso, const std::string &grafo,
+           const std::function<void()> &op, double unidades = 1) {
+  op();
+  long total = 0, tanda = 1;
+  long r0 = reservas.load(), b0 = bytes_reservados.load();
+  auto t0 = std::chrono::steady_clock::now();
+  double transcurrido = 0;
+  while (transcurrido < min_segundos) {
+    for (long i = 0; i < tanda; i++)
+      op();
+    total += tanda;
+    tanda *= 2;
+    transcurrido = std::chrono::duration<double>(
+                       std::chrono::steady_clock::now() - t0)
+                       .count();
+  }
+  double ops = total * unidades;
+  imprimir(caso, grafo, transcurrido * 1e9 / ops,
+           (reservas.load() - r0) / ops, (bytes_reservados.load() - b0) / ops);
+}
+
+void medirGrafo(Grafo &g) {
+  // --- carga del archivo ---
+  medir("carga", g.nombre, [&] {
+    int n;
+    std::vector<std::vector<int>> adj;
+    GraphReader::loadFromFile(g.archivo, n, adj);
+  });
+
+  // parametros del tuning; s no se usa porque no se llama a getSolution
+  BRKGA b(g.n, 264, 0.14, 0.25, 0.65, 10, g.adj, 42);
+  volatile size_t sumidero = 0; // evita que se descarten los resultados
+
+  medir("greedyDet", g.nombre,
+        [&] { sumidero += AccesoBenchmark::greedyRand(b, 1).size(); });
+  medir("greedyRand", g.nombre,
+        [&] { sumidero += AccesoBenchmark::greedyRand(b, 10).size(); });
+
+  std::vector<int> inicial = AccesoBenchmark::greedyRand(b, 10);
+  medir("sa.iter", g.nombre,
+        [&] { sumidero += AccesoBenchmark::saCorto(b, inicial, g.n).size(); },
+        g.n);
+
+  Individuo a = AccesoBenchmark::mutante(b), c = AccesoBenchmark::mutante(b);
+  medir("decoder", g.nombre, [&] { sumidero += b.decoder(a).size(); });
+  medir("cruce", g.nombre,
+        [&] { sumidero += AccesoBenchmark::cruzar(b, a, c).cr.size(); });
+  medir("mutante", g.nombre,
+        [&] { sumidero += AccesoBenchmark::mutante(b).cr.size(); });
+
+  // V' como en BARRAKUDA: union de soluciones de la elite, la mejor como
+  // incumbente
+  std::vector<char> en(g.n + 1, 0);
+  std::vector<int> vprime, incumbente;
+  for (int k = 0; k < 3; k++) {
+    std::vector<int> sol = b.decoder(AccesoBenchmark::mutante(b));
+    if (sol.size() > incumbente.size())
+      incumbente = sol;
+    for (int v : sol)
+      if (!en[v]) {
+        en[v] = 1;
+        vprime.push_back(v);
+      }
+  }
+  double t_modelo = 0;
+  long llamadas = 0;
+  medir("subinstancia", g.nombre, [&] {
+    t_modelo += AccesoBenchmark::subinstancia(b, vprime, incumbente);
+    llamadas++;
+  });
+  // el modelo no tiene un conteo propio de reservas
+  imprimir("subinstancia.modelo", g.nombre, t_modelo * 1e9 / llamadas, -1,
+           -1);
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  std::string dataset = "../tuning/Instances";
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    if (arg == "-dataset" && i + 1 < argc)
+      dataset = argv[++i];
+    else if (arg == "-min" && i + 1 < argc)
+      min_segundos = std::stod(argv[++i]);
+    else if (arg == "-csv")
+      salida_csv = true;
+    else {
+      std::cerr << "Uso: ./brkga_bench [-dataset <dir>] [-min <segundos>] "
+                   "[-csv]\n";
+      return 1;
+    }
+  }
+  std::cerr << "# solver de sub-instancias: " << solverPorDefecto() << "\n";
+  imprimirCabecera();
+
+  // --- Instancias fijas del dataset (las que falten se omiten) ---
+  for (const char *nombre :
+       {"erdos_n1000_p0c0.3_0", "erdos_n1000_p0c0.6_0",
+        "erdos_n1000_p0c0.9_0"}) {
+    Grafo g;
+    g.nombre = nombre;
+    g.archivo = dataset + "/" + nombre + ".graph";
+    if (access(g.archivo.c_str(), R_OK) != 0) {
+      std::cerr << "# no encontrado: " << g.archivo << "\n";
+      continue;
+    }
+    GraphReader::loadFromFile(g.archivo, g.n, g.adj);
+    medirGrafo(g);
+  }
+
+  // --- Erdos-Renyi generados ---
+  struct {
+    int n;
+    double p;
+  } generados[] = {{1000, 0.1}, {2000, 0.5}, {3000, 0.1}};
+  for (auto gen : generados) {
+    Grafo g = generarER(gen.n, gen.p, 12345);
+    g.archivo = escribirTemporal(g);
+    if (g.archivo.empty()) {
+      std::cerr << "# no se pudo escribir el grafo temporal\n";
+      return 1;
+    }
+    medirGrafo(g);
+    std::remove(g.archivo.c_str());
+  }
+  return 0;
+}
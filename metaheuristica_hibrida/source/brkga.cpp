@@ -1,51 +1,46 @@
-#include "brkga_class.h"
+#include "ejecucion.h"
+#include "utils/Batch.h"
 #include "utils/GraphReader.h"
 #include <iostream>
+#include <string>
+#include <vector>
 
 int main(int argc, char *argv[]) {
 
-  /*
-  p = tamaño población
-  pe = población elite
-  pm = población mutante
-  rhoe = probabilidad de heredar del elite
-  */
+  // --- Modo batch: todos los trabajos del manifiesto en este proceso, cada
+  // grafo se lee una sola vez (ver utils/Batch.h). La semilla de cada
+  // trabajo reemplaza a -seed
+  if (argc >= 2 && std::string(argv[1]) == "-batch") {
+    return Batch::main(argc, argv, 1,
+                       [](int V, const std::vector<std::vector<int>> &adj,
+                          const BatchJob &job, int &value) {
+                         Parametros par;
+                         std::string ignorado;
+                         if (!leerParametros(job.params, par, ignorado) ||
+                             par.s <= 0 || par.p <= 0)
+                           return false;
+                         par.seed = job.seed;
+                         value = resolver(V, adj, par);
+                         return true;
+                       });
+  }
 
   // Graph reading:
-  if (argc != 15) {
+  if (argc < 15) {
     std::cerr << "Uso: ./brkga -i <instancia.txt> -t <tiempoSegundos> "
                  "-p <poblacion> -pe <elite> -pm <mutantes> -rhoe <herencia> "
-                 "-seed <semilla>\n";
+                 "-seed <semilla> [-ls <presupuesto>] "
+                 "[-stag <generaciones>] [-div <diversidad>] [-warm <fraccion>] "
+                 "[-trace <archivo>] [-dense <densidad>] [-async <solves>] "
+                 "[-solver cplex|bnb|ls] [-vcap <nodos>] [-adapt <0|1>] [-kernel <0|1>]\n"
+                 "       ./brkga -batch <manifiesto> [-o <salida.csv>]\n";
     return 1;
   }
 
   std::string filename;
-  double s = 0, pe = 0, pm = 0, rhoe = 0;
-  int p = 0;
-  unsigned int seed = 0;
-
-  // --- Leer argumentos ---
-  for (int i = 1; i < argc; i++) {
-    std::string arg = argv[i];
-    if (arg == "-i")
-      filename = argv[++i];
-    else if (arg == "-t")
-      s = std::stod(argv[++i]);
-    else if (arg == "-p")
-      p = std::stoi(argv[++i]);
-    else if (arg == "-pe")
-      pe = std::stod(argv[++i]);
-    else if (arg == "-pm")
-      pm = std::stod(argv[++i]);
-    else if (arg == "-rhoe")
-      rhoe = std::stod(argv[++i]);
-    else if (arg == "-seed")
-      seed = std::stoul(argv[++i]);
-    else {
-      std::cerr << "Argumento desconocido: " << arg << "\n";
-      return 1;
-    }
-  }
+  Parametros par;
+  if (!leerParametros({argv + 1, argv + argc}, par, filename))
+    return 1;
 
   int V;
   std::vector<std::vector<int>> adj;
@@ -55,16 +50,8 @@ int main(int argc, char *argv[]) {
     return 1;
   }
 
-  // --- BRKGA Algorithm ---
-  BRKGA brkga(V, p, pe, pm, rhoe, s, adj, seed);
-  std::vector<int> independentSet = brkga.getSolution();
-
-  // for (int i = 0; i < independentSet.size(); i++) {
-  //   std::cout << independentSet[i] << " ";
-  // }
-  // std::cout << "\n";
-  int aux = independentSet.size();
-  std::cout << aux * (-1) << "\n";
+  int tam = resolver(V, std::move(adj), par);
+  std::cout << -tam << "\n";
 
   return 0;
 }
@@ -1,11 +1,11 @@
 #include "brkga_class.h"
+#include "utils/FixedBitset.h"
+#include "utils/ReducingPeeling.h"
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <iostream>
 #include <random>
-#include <map>
-
-ILOSTLBEGIN
 
 bool Individuo::operator<(const Individuo &other) const {
   return fitness > other.fitness;
@@ -16,7 +16,37 @@ BRKGA::BRKGA(int n, int p, double pe, double pm, double rhoe, double s,
     : n(n), p(p), pe(pe), pm(pm), rhoe(rhoe), s(s), poblacion(p),
       nueva_poblacion(p), adj(adj), rng(seed) {
   best_global_fitness = 0;
-  //start_time = std::chrono::high_resolution_clock::now();
+  ls_budget = 0;
+  num_generaciones = 0;
+  gens_sin_mejora = 0;
+  stag_gens = 0;
+  min_div = 0.05;
+  warm_frac = 0.0;
+  cota_superior = n;
+
+  palabras = (n + 64) / 64;
+  if (n <= 4096) {
+    filas.assign((size_t)(n + 1) * palabras, 0);
+    for (int v = 1; v <= n; v++)
+      for (int u : adj[v])
+        bits::set(&filas[(size_t)v * palabras], u);
+  }
+  num_decodificaciones = 0;
+  start_time = std::chrono::steady_clock::now();
+  max_retraso = 50;
+  nombre_solver = solverPorDefecto();
+  cap_vprime = 0;
+  llamadas_exactas = 0;
+  t_exacto_modelo = 0.0;
+  t_exacto_solver = 0.0;
+  adaptativo = false;
+  k_frecuencia = 10; // Ejecutar BARRAKUDA cada 10 generaciones
+  limite_exacto = 1.0;
+  tasa_exacta = 0.0;
+  tasa_ga = 0.0;
+  t_ultima_llamada = 0.0;
+  fitness_ultima_llamada = 0;
+  cache.reset(new CacheSubinstancias(n));
 }
 
 BRKGA::~BRKGA() {}
@@ -26,20 +56,28 @@ Inicializamos la población generando p individuos con cromosomas aleatorios.
 Cada gen del cromosoma se genera de manera uniforme en el rango [0,1].
 Definimos el fitness de cada individuo como -1 inicialmente, indicando que aún
 no ha sido evaluado.
+Si warm_frac > 0, los primeros warm_frac * p individuos se siembran con
+soluciones heuristicas: el primero con reducing-peeling y el resto
+alternando greedy aleatorizado y SA corto sobre un greedy aleatorizado.
 */
 void BRKGA::inicializar_poblacion() {
-  std::uniform_real_distribution<double> dist(0.0, 1.0);
-  for (int i = 0; i < p; i++) {
-    Individuo individuo;
-    cromosoma cr(n);
-    for (int j = 0; j < n; j++) {
-      cr[j].first = dist(rng);
-      cr[j].second = j + 1;
-    }
-    individuo.cr = cr;
-    individuo.fitness = getFitness(decoder(individuo));
+  const int k_rcl = 10; // tamaño de la RCL del greedy aleatorizado
+  int nSemillas = std::min(p, (int)(p * warm_frac));
+  for (int i = 0; i < nSemillas; i++) {
+    std::vector<int> sol;
+    if (i == 0)
+      sol = reducingPeeling(n, adj);
+    else if (i % 2 == 1)
+      sol = greedyRand(k_rcl);
+    else
+      sol = saCorto(greedyRand(k_rcl), n);
+    poblacion[i] = codificar(sol);
+    evaluar(poblacion[i]);
+  }
 
-    poblacion[i] = individuo;
+  for (int i = nSemillas; i < p; i++) {
+    poblacion[i] = mutante();
+    evaluar(poblacion[i]);
   }
   std::sort(poblacion.begin(), poblacion.end());
 
@@ -47,22 +85,28 @@ void BRKGA::inicializar_poblacion() {
   best_global = poblacion[0];
   best_global_fitness = getFitness(decoder(best_global));
 
-  // Imprime el primer log "Any-Time"
-  auto now = std::chrono::high_resolution_clock::now();
-  double elapsed_s = std::chrono::duration<double>(now - start_time).count();
-
-  // std::cerr << best_global_fitness << " " << elapsed_s << "\n";
+  // Registra el primer evento "Any-Time"
+  traza.registrar(MEJORA, num_generaciones, num_decodificaciones,
+                  best_global_fitness);
 }
 
 std::vector<int> BRKGA::decoder(Individuo ind) {
-  std::vector<int> independentSet;
-  std::vector<bool> marked(n + 1, 0);
+  num_decodificaciones++;
 
   // ordenar individuo segun su cromosoma.first de mayor a menor
   std::sort(ind.cr.begin(), ind.cr.end(),
             [](const std::pair<double, int> &a,
                const std::pair<double, int> &b) { return a.first > b.first; });
 
+  if (!filas.empty())
+    return bits::dispatchWidth(palabras, [&](auto w) {
+      return seleccionar<decltype(w)::value>(ind.cr);
+    });
+
+  // (solo el camino sin filas de bits usa la marca por nodo)
+  std::vector<int> independentSet;
+  std::vector<bool> marked(n + 1, 0);
+
   // enfoque greddy, se toma el primer vertice al siguiente
   for (const auto &par : ind.cr) {
     int node = par.second;
@@ -79,8 +123,332 @@ std::vector<int> BRKGA::decoder(Individuo ind) {
   return independentSet;
 }
 
+// mismo greedy del decoder sobre filas de bits, con el ancho fijado en
+// compilacion para n = 1000/2000/3000 (utils/FixedBitset.h)
+template <int WORDS>
+std::vector<int> BRKGA::seleccionar(const cromosoma &cr) const {
+  std::vector<int> independentSet;
+  std::vector<uint64_t> marked(palabras, 0);
+  for (const auto &par : cr) {
+    int node = par.second;
+    if (node == 0 || bits::test(marked.data(), node))
+      continue;
+    independentSet.push_back(node);
+    bits::set(marked.data(), node);
+    bits::orInto<WORDS>(marked.data(), &filas[(size_t)node * palabras],
+                        palabras);
+  }
+  return independentSet;
+}
+
 int BRKGA::getFitness(std::vector<int> decodified) { return decodified.size(); }
 
+void BRKGA::setLocalSearch(long budget) { ls_budget = budget; }
+
+void BRKGA::setWarmStart(double frac) { warm_frac = frac; }
+
+void BRKGA::setUpperBound(int cota) { cota_superior = cota; }
+
+/*
+Codifica una solucion con el mismo esquema que super_ind en BARRAKUDA: los
+nodos de la solucion reciben llaves altas (0.9 + ruido) y el resto llaves
+bajas (0.1 + ruido), asi el decoder los elige primero.
+*/
+Individuo BRKGA::codificar(const std::vector<int> &sol) {
+  Individuo ind;
+  ind.cr.resize(n);
+
+  std::vector<char> elegido(n + 1, 0);
+  for (int v : sol)
+    elegido[v] = 1;
+
+  std::uniform_real_distribution<double> noise(0.0, 0.1);
+  for (int i = 0; i < n; ++i) {
+    int nodo_id = i + 1;
+    ind.cr[i].second = nodo_id;
+    if (elegido[nodo_id])
+      ind.cr[i].first = 0.9 + noise(rng);
+    else
+      ind.cr[i].first = 0.1 + noise(rng);
+  }
+  return ind;
+}
+
+// greedy aleatorizado: se elige al azar entre los k nodos libres de menor
+// grado (RCL, igual que greedyRand)
+std::vector<int> BRKGA::greedyRand(int k) {
+  std::vector<std::pair<int, int>> grados(n);
+  for (int v = 1; v <= n; v++)
+    grados[v - 1] = {adj[v].size(), v};
+  std::sort(grados.begin(), grados.end());
+
+  std::vector<int> independentSet;
+  std::vector<bool> marked(n + 1, 0);
+  std::vector<int> rcl;
+  size_t inicio = 0; // primer nodo libre en el orden por grado
+  while (true) {
+    while (inicio < grados.size() && marked[grados[inicio].second])
+      inicio++;
+    rcl.clear();
+    for (size_t i = inicio; i < grados.size() && (int)rcl.size() < k; i++)
+      if (!marked[grados[i].second])
+        rcl.push_back(grados[i].second);
+    if (rcl.empty())
+      break;
+
+    std::uniform_int_distribution<int> elegir(0, rcl.size() - 1);
+    int node = rcl[elegir(rng)];
+    independentSet.push_back(node);
+    marked[node] = true;
+    for (const auto &neighbor : adj[node])
+      marked[neighbor] = true;
+  }
+  return independentSet;
+}
+
+/*
+Simulated annealing corto a partir de una solucion: se elige un nodo v fuera
+de la solucion y se inserta sacando sus vecinos en la solucion. El cambio de
+tamaño es 1 - (vecinos en la solucion); los empeoramientos se aceptan con
+probabilidad exp(delta / T). La temperatura baja de 1 a 0.01 en iters pasos.
+*/
+std::vector<int> BRKGA::saCorto(const std::vector<int> &inicial, int iters) {
+  std::vector<char> inSol(n + 1, 0);
+  std::vector<int> tight(n + 1, 0);
+  for (int v : inicial) {
+    inSol[v] = 1;
+    for (int u : adj[v])
+      tight[u]++;
+  }
+
+  std::vector<int> mejor = inicial;
+  int actual = inicial.size();
+  double T = 1.0;
+  double alpha = std::pow(0.01, 1.0 / std::max(1, iters));
+  std::uniform_int_distribution<int> nodo(1, n);
+  std::uniform_real_distribution<double> dist(0.0, 1.0);
+
+  for (int it = 0; it < iters; it++, T *= alpha) {
+    int v = nodo(rng);
+    if (inSol[v])
+      continue;
+    int delta = 1 - tight[v];
+    if (delta < 0 && dist(rng) >= std::exp(delta / T))
+      continue;
+
+    for (int u : adj[v]) {
+      if (inSol[u]) {
+        inSol[u] = 0;
+        for (int w : adj[u])
+          tight[w]--;
+      }
+    }
+    inSol[v] = 1;
+    for (int u : adj[v])
+      tight[u]++;
+    actual += delta;
+
+    if (actual > (int)mejor.size()) {
+      mejor.clear();
+      for (int u = 1; u <= n; u++)
+        if (inSol[u])
+          mejor.push_back(u);
+    }
+  }
+  return mejor;
+}
+
+void BRKGA::setStagnation(int gens, double div) {
+  stag_gens = gens;
+  min_div = div;
+}
+
+/*
+Diversidad de la poblacion: promedio, sobre todos los genes, de la desviacion
+estandar de las llaves de ese gen entre los primeros m individuos (la poblacion
+debe estar ordenada). Se mide sobre la elite porque los mutantes son siempre
+aleatorios. Llaves uniformes dan ~0.29; una elite convergida tiende a 0.
+*/
+double BRKGA::diversidad(int m) {
+  std::vector<double> suma(n, 0.0), suma2(n, 0.0);
+  for (int i = 0; i < m; i++) {
+    for (int j = 0; j < n; j++) {
+      double k = poblacion[i].cr[j].first;
+      suma[j] += k;
+      suma2[j] += k * k;
+    }
+  }
+  double total = 0.0;
+  for (int j = 0; j < n; j++) {
+    double media = suma[j] / m;
+    total += std::sqrt(std::max(0.0, suma2[j] / m - media * media));
+  }
+  return total / n;
+}
+
+/*
+Si el mejor global no mejora en stag_gens generaciones se actua sobre los
+individuos no elite (la elite se conserva):
+ - diversidad < min_div: reinicio parcial, llaves nuevas uniformes.
+ - en otro caso: shaking, cada llave se re-sortea con probabilidad 0.1.
+Cada evento se informa por stderr con el tiempo transcurrido.
+*/
+void BRKGA::controlarEstancamiento() {
+  if (stag_gens <= 0 || gens_sin_mejora < stag_gens)
+    return;
+
+  int nElite = p * pe;
+  std::sort(poblacion.begin(), poblacion.end());
+
+  double div = diversidad(std::max(2, nElite));
+  bool reinicio = div < min_div;
+
+  std::uniform_real_distribution<double> dist(0.0, 1.0);
+  for (int i = nElite; i < p; i++) {
+    for (int j = 0; j < n; j++) {
+      if (reinicio || dist(rng) < 0.1)
+        poblacion[i].cr[j].first = dist(rng);
+    }
+    evaluar(poblacion[i]);
+  }
+  std::sort(poblacion.begin(), poblacion.end());
+
+  if (poblacion[0].fitness > best_global_fitness) {
+    best_global_fitness = poblacion[0].fitness;
+    best_global = poblacion[0];
+    traza.registrar(MEJORA, num_generaciones, num_decodificaciones,
+                    best_global_fitness);
+  }
+  gens_sin_mejora = 0;
+
+  traza.registrar(reinicio ? REINICIO : SHAKING, num_generaciones,
+                  num_decodificaciones, best_global_fitness);
+  std::cerr << "# " << (reinicio ? "reinicio" : "shaking")
+            << " gen=" << num_generaciones << " t=" << traza.segundos()
+            << " div=" << div << " mejor=" << best_global_fitness << "\n";
+}
+
+void BRKGA::evaluar(Individuo &ind) {
+  std::vector<int> sol = decoder(ind);
+  if (ls_budget > 0) {
+    size_t antes = sol.size();
+    sol = busquedaLocal(sol);
+    if (sol.size() > antes)
+      recodificar(ind, sol);
+  }
+  ind.fitness = getFitness(sol);
+}
+
+/*
+Busqueda local (1,2)-swap: para cada nodo x de la solucion se buscan dos
+vecinos u, w de x que no sean adyacentes entre si y cuyo unico vecino en la
+solucion sea x (tight = 1). Sacar x y agregar u, w aumenta la solucion en uno.
+Despues de cada movimiento se agregan los vecinos de x que quedaron libres
+(tight = 0) para que la solucion siga siendo maximal.
+El costo se mide en entradas de adyacencia revisadas y se corta al llegar a
+ls_budget.
+*/
+std::vector<int> BRKGA::busquedaLocal(const std::vector<int> &sol) {
+  std::vector<char> inSol(n + 1, 0);
+  std::vector<int> tight(n + 1, 0); // vecinos de cada nodo en la solucion
+  std::vector<int> marca(n + 1, 0);
+  int sello = 0;
+  long trabajo = 0;
+
+  auto insertar = [&](int v) {
+    inSol[v] = 1;
+    for (int u : adj[v])
+      tight[u]++;
+    trabajo += adj[v].size();
+  };
+
+  std::vector<int> pendientes(sol.begin(), sol.end());
+  for (int v : sol)
+    insertar(v);
+
+  std::vector<int> libres; // candidatos con tight = 1 alrededor de x
+  for (size_t idx = 0; idx < pendientes.size() && trabajo < ls_budget; idx++) {
+    int x = pendientes[idx];
+    if (!inSol[x])
+      continue;
+
+    libres.clear();
+    for (int v : adj[x])
+      if (v != 0 && !inSol[v] && tight[v] == 1)
+        libres.push_back(v);
+    trabajo += adj[x].size();
+    if (libres.size() < 2)
+      continue;
+
+    // buscamos un par (u, w) de candidatos no adyacentes
+    int u = -1, w = -1;
+    for (size_t a = 0; a + 1 < libres.size() && u == -1; a++) {
+      sello++;
+      for (int v : adj[libres[a]])
+        marca[v] = sello;
+      trabajo += adj[libres[a]].size();
+      for (size_t b = a + 1; b < libres.size(); b++) {
+        if (marca[libres[b]] != sello) {
+          u = libres[a];
+          w = libres[b];
+          break;
+        }
+      }
+      if (trabajo >= ls_budget)
+        break;
+    }
+    if (u == -1)
+      continue;
+
+    // aplicamos el movimiento: sale x, entran u y w
+    inSol[x] = 0;
+    for (int v : adj[x])
+      tight[v]--;
+    insertar(u);
+    insertar(w);
+    pendientes.push_back(u);
+    pendientes.push_back(w);
+
+    // completamos con los vecinos de x que quedaron libres
+    for (int v : adj[x]) {
+      if (v != 0 && !inSol[v] && tight[v] == 0) {
+        insertar(v);
+        pendientes.push_back(v);
+      }
+    }
+  }
+
+  std::vector<int> mejorada;
+  for (int v = 1; v <= n; v++)
+    if (inSol[v])
+      mejorada.push_back(v);
+  return mejorada;
+}
+
+/*
+Recodificacion lamarckiana: igual que super_ind en runBarrakuda, los nodos de
+la solucion deben quedar con llaves mas altas que el resto. Solo se suben las
+llaves de los nodos elegidos que estan por debajo de la mayor llave de un nodo
+no elegido; las demas llaves no se tocan. Como la solucion es maximal, el
+decoder vuelve a producir exactamente la misma solucion.
+*/
+void BRKGA::recodificar(Individuo &ind, const std::vector<int> &sol) {
+  std::vector<char> elegido(n + 1, 0);
+  for (int v : sol)
+    elegido[v] = 1;
+
+  double umbral = 0.0;
+  for (int j = 0; j < n; j++)
+    if (!elegido[ind.cr[j].second])
+      umbral = std::max(umbral, ind.cr[j].first);
+
+  std::uniform_real_distribution<double> dist(0.5, 1.0);
+  for (int j = 0; j < n; j++) {
+    if (elegido[ind.cr[j].second] && ind.cr[j].first <= umbral)
+      ind.cr[j].first = umbral + (1.0 - umbral) * dist(rng);
+  }
+}
+
 void BRKGA::generacion() {
   /*
     nElite = número de individuos elite
@@ -94,16 +462,18 @@ void BRKGA::generacion() {
   // Ordenamos la población por fitness para poder seleccionar a los elite.
   std::sort(poblacion.begin(), poblacion.end());
 
+  num_generaciones++;
+
   // Any-Time
+  gens_sin_mejora++;
   if (poblacion[0].fitness > best_global_fitness) {
     best_global_fitness = poblacion[0].fitness;
     best_global = poblacion[0];
+    gens_sin_mejora = 0;
 
-    // Imprime el log "Any-Time"
-    auto now = std::chrono::high_resolution_clock::now();
-    double elapsed_s = std::chrono::duration<double>(now - start_time).count();
-
-    // std::cerr << best_global_fitness << " " << elapsed_s << "\n";
+    // Registra el evento "Any-Time"
+    traza.registrar(MEJORA, num_generaciones, num_decodificaciones,
+                    best_global_fitness);
   }
 
   for (int i = 0; i < nElite; i++) {
@@ -112,18 +482,9 @@ void BRKGA::generacion() {
   }
 
   // Se crean mutantes
-  std::uniform_real_distribution<double> dist(0.0, 1.0);
   for (int i = 0; i < nMutante; i++) {
-    Individuo individuo;
-    cromosoma cr(n);
-    for (int j = 0; j < n; j++) {
-      cr[j].first = dist(rng);
-      cr[j].second = j + 1;
-    }
-    individuo.cr = cr;
-    individuo.fitness = getFitness(decoder(individuo));
-
-    nueva_poblacion[nElite + i] = individuo;
+    nueva_poblacion[nElite + i] = mutante();
+    evaluar(nueva_poblacion[nElite + i]);
   }
 
   /* Realizamos los cruces para generar los individuos restantes de la nueva
@@ -138,139 +499,228 @@ void BRKGA::generacion() {
   std::uniform_int_distribution<int> distNonElite(nElite, p - 1);
 
   for (int i = 0; i < nCruce; i++) {
-    Individuo padre_elite = poblacion[distElite(rng)];
-    Individuo padre_no_elite = poblacion[distNonElite(rng)];
-
-    Individuo hijo;
-    hijo.cr.resize(n);
-
-    std::uniform_real_distribution<double> coin(0.0, 1.0);
-    for (int j = 0; j < n; ++j) {
-      if (coin(rng) < rhoe) {
-        hijo.cr[j].first = padre_elite.cr[j].first;
-        hijo.cr[j].second = padre_elite.cr[j].second;
-      } else {
-        hijo.cr[j].first = padre_no_elite.cr[j].first;
-        hijo.cr[j].second = padre_no_elite.cr[j].second;
-      }
-    }
+    const Individuo &padre_elite = poblacion[distElite(rng)];
+    const Individuo &padre_no_elite = poblacion[distNonElite(rng)];
+
+    Individuo &hijo = nueva_poblacion[nElite + nMutante + i];
+    hijo = cruzar(padre_elite, padre_no_elite);
     /*ahora toca evaluar al hijo*/
-    hijo.fitness = getFitness(decoder(hijo));
-    nueva_poblacion[nElite + nMutante + i] = hijo;
+    evaluar(hijo);
   }
   poblacion = nueva_poblacion;
 }
 
-std::vector<int> BRKGA::solveSubInstance(const std::set<int>& V_prime) {
-    IloEnv env;
-    std::vector<int> solution_mis;
-    
-    try {
-        IloModel model(env);
-        std::map<int, IloNumVar> x;
-
-        // Variables: Una por cada nodo del grafo original
-        // Usamos índices 1-based como tu vector adj (ajustar si adj empieza en 0 o 1)
-        // Asumiendo que tu decoder usa 'j+1', tus nodos van de 1 a N.
-        for (int i = 1; i <= n; ++i) {
-            x[i] = IloNumVar(env, 0, 1, ILOINT);
-            
-            // Restricción BARRAKUDA: Si NO está en V_prime, forzar a 0
-            if (V_prime.find(i) == V_prime.end()) {
-                model.add(x[i] == 0);
-            }
-        }
+// individuo con llaves uniformes en [0, 1)
+Individuo BRKGA::mutante() {
+  std::uniform_real_distribution<double> dist(0.0, 1.0);
+  Individuo individuo;
+  individuo.cr.resize(n);
+  for (int j = 0; j < n; j++) {
+    individuo.cr[j].first = dist(rng);
+    individuo.cr[j].second = j + 1;
+  }
+  return individuo;
+}
 
-        // Restricciones MISP: Para cada arista u-v, x[u] + x[v] <= 1
-        for (int u = 1; u <= n; ++u) {
-            if (adj.size() > u) { // Chequeo de seguridad
-                for (int v : adj[u]) {
-                    // Evitar duplicados considerando solo u < v
-                    if (u < v) {
-                        model.add(x[u] + x[v] <= 1);
-                    }
-                }
-            }
-        }
+// cruce uniforme sesgado: cada gen viene del padre elite con probabilidad rhoe
+Individuo BRKGA::cruzar(const Individuo &padre_elite,
+                        const Individuo &padre_no_elite) {
+  Individuo hijo;
+  hijo.cr.resize(n);
+
+  std::uniform_real_distribution<double> coin(0.0, 1.0);
+  for (int j = 0; j < n; ++j) {
+    if (coin(rng) < rhoe) {
+      hijo.cr[j].first = padre_elite.cr[j].first;
+      hijo.cr[j].second = padre_elite.cr[j].second;
+    } else {
+      hijo.cr[j].first = padre_no_elite.cr[j].first;
+      hijo.cr[j].second = padre_no_elite.cr[j].second;
+    }
+  }
+  return hijo;
+}
 
-        // Función Objetivo: Maximizar nodos seleccionados
-        IloExpr objective(env);
-        for (auto const& [id, var] : x) {
-            objective += var;
-        }
-        model.add(IloMaximize(env, objective));
-        objective.end();
-
-        IloCplex cplex(model);
-        cplex.setOut(env.getNullStream()); // Silenciar output
-        cplex.setParam(IloCplex::Param::TimeLimit, 1.0); // Límite de 1 segundo por llamada (ajustable)
-        cplex.setParam(IloCplex::Param::Threads, 1);     // Un solo hilo para no saturar
-
-        if (cplex.solve()) {
-            for (auto const& [id, var] : x) {
-                if (cplex.getValue(var) > 0.5) {
-                    solution_mis.push_back(id);
-                }
-            }
+/*
+Resuelve el MISP exacto sobre V' con el solver persistente del backend
+elegido. Con CPLEX el ambiente, las variables y el objeto IloCplex se crean
+una sola vez por ejecucion y cada llamada solo ajusta cotas y agrega las
+filas que faltan. En todos los backends la mejor solucion de la elite es la
+cota inferior inicial.
+*/
+std::vector<int> BRKGA::solveSubInstance(const std::vector<int>& V_prime,
+                                         const std::vector<int>& incumbente) {
+    if (!contexto) {
+        contexto = crearSolver(nombre_solver, n, adj);
+    }
+    if (adaptativo) {
+        contexto->setLimiteTiempo(limiteLlamada());
+    }
+    return contexto->resolver(V_prime, incumbente, ultima_llamada);
+}
+
+void BRKGA::setSolver(const std::string &nombre) {
+    nombre_solver = nombre;
+    contexto.reset();
+    for (auto& slot : slots) {
+        slot.contexto.reset();
+    }
+}
+
+void BRKGA::registrarLlamada(int generacion, int valor, int tam_vprime,
+                             const LlamadaExacta &stats) {
+    traza.registrarExacto(generacion, num_decodificaciones, valor, tam_vprime,
+                          stats.filas, stats.t_modelo, stats.t_solver,
+                          stats.gap);
+    llamadas_exactas++;
+    t_exacto_modelo += stats.t_modelo;
+    t_exacto_solver += stats.t_solver;
+}
+
+void BRKGA::setAdaptive(bool activo) { adaptativo = activo; }
+
+// tiempo limite de la proxima llamada, sin pasarse del final de la ejecucion
+double BRKGA::limiteLlamada() const {
+    double restante = s - std::chrono::duration<double>(
+                              std::chrono::steady_clock::now() - start_time)
+                              .count();
+    return std::max(0.01, std::min(limite_exacto, restante));
+}
+
+/*
+Control adaptativo de BARRAKUDA. Tras cada llamada se comparan dos tasas de
+mejora por segundo, suavizadas con una media exponencial: la del solver
+(nodos ganados sobre la incumbente / tiempo de la llamada) y la del BRKGA
+solo (mejora del mejor global desde la llamada anterior / tiempo de
+generaciones). Si el solver rinde mas se llama el doble de seguido, si rinde
+menos la mitad. El tamaño de V' y el tiempo limite se ajustan con el
+resultado de la llamada:
+- optima sin ganancia: la sub-instancia es facil, se agranda V' un 25%.
+- cortada por tiempo con ganancia: vale la pena, se da 50% mas de tiempo.
+- cortada por tiempo sin ganancia: se achica V' un 20% y el tiempo un 25%.
+Cada decision queda en la traza como evento AJUSTE.
+*/
+void BRKGA::ajustarBarrakuda(int ganancia, int valor, int tam_vprime,
+                             const LlamadaExacta &stats) {
+    const double alfa = 0.3;
+    double ahora = traza.segundos();
+    double t_llamada = std::max(1e-3, stats.t_modelo + stats.t_solver);
+    double t_ga = ahora - t_ultima_llamada;
+    if (slots.empty()) t_ga -= t_llamada; // sincrono: el BRKGA estuvo parado
+    int ganancia_ga = std::max(0, best_global_fitness - fitness_ultima_llamada);
+
+    tasa_exacta = (1 - alfa) * tasa_exacta +
+                  alfa * std::max(0, ganancia) / t_llamada;
+    tasa_ga = (1 - alfa) * tasa_ga + alfa * ganancia_ga / std::max(1e-3, t_ga);
+
+    // frecuencia
+    if (tasa_exacta > tasa_ga) {
+        k_frecuencia = std::max(2, k_frecuencia / 2);
+    } else if (tasa_exacta < tasa_ga) {
+        k_frecuencia = std::min(80, k_frecuencia * 2);
+    }
+
+    // tamaño de V' y tiempo limite
+    // se parte del |V'| real: un tope mayor que la union no la agranda
+    int tope = tam_vprime;
+    double limite_max = std::max(1.0, s * 0.2);
+    if (stats.gap == 0.0) {
+        if (ganancia <= 0) {
+            cap_vprime = std::min(n, tope + std::max(1, tope / 4));
         }
-    } catch (...) {
-        // En caso de error de CPLEX, retornamos vector vacío
+    } else if (ganancia > 0) {
+        limite_exacto = std::min(limite_max, limite_exacto * 1.5);
+    } else {
+        cap_vprime = std::max(20, tope - tope / 5);
+        limite_exacto = std::max(0.05, limite_exacto * 0.75);
     }
-    env.end();
-    return solution_mis;
+
+    traza.registrarAjuste(num_generaciones, num_decodificaciones, k_frecuencia,
+                          cap_vprime, limite_exacto);
+    t_ultima_llamada = ahora;
+    fitness_ultima_llamada = std::max(best_global_fitness, valor);
 }
 
-void BRKGA::runBarrakuda() {
-    // CONSTRUCCIÓN DE V' (Merge)
+void BRKGA::setAsync(int en_vuelo, int max_retraso) {
+    slots.clear();
+    slots.resize(std::max(0, en_vuelo));
+    this->max_retraso = max_retraso;
+}
+
+void BRKGA::setVPrimeCap(int k) { cap_vprime = std::max(0, k); }
+
+/*
+Construye V' uniendo las soluciones de los 'na' mejores individuos en un
+bitset, contando en frecuencia cuantas soluciones elite contienen a cada nodo.
+Con cap_vprime > 0 y mas nodos que el tope, V' se queda con la incumbente
+completa (para que siga siendo un punto de partida factible) y se completa
+con los nodos mas frecuentes. V_prime sale ordenado por id.
+incumbente queda con la solucion del mejor, que esta dentro de V'.
+*/
+void BRKGA::construirVPrime(std::vector<int>& V_prime, std::vector<int>& incumbente) {
     // Tomamos los 'na' mejores individuos.
-    int na = std::max(1, (int)(p * 0.15)); 
-    std::set<int> V_prime;
+    int na = std::max(1, (int)(p * 0.15));
+    int W = (n + 64) / 64;
+    if (en_vprime.empty()) {
+        en_vprime.assign(W, 0);
+        frecuencia.assign(n + 1, 0);
+    }
 
     // La población ya está ordenada al inicio de generacion() o init()
+    std::vector<int> tocados; // nodos con frecuencia > 0
     for (int i = 0; i < na; ++i) {
         std::vector<int> sol = decoder(poblacion[i]);
         for(int nodo : sol) {
-            V_prime.insert(nodo);
+            if (frecuencia[nodo]++ == 0) tocados.push_back(nodo);
+        }
+        if (i == 0) {
+            incumbente = sol;
         }
     }
 
-    // Si V_prime es muy pequeño, quizás no vale la pena (opcional)
-    if (V_prime.empty()) return;
-
-    // Mejor combinacion con los nodos de V'
-    std::vector<int> exact_sol = solveSubInstance(V_prime);
+    if (cap_vprime > 0 && (int)tocados.size() > cap_vprime) {
+        // la incumbente va primero con una frecuencia ficticia mayor a na
+        for (int v : incumbente) frecuencia[v] += na;
+        std::stable_sort(tocados.begin(), tocados.end(), [&](int a, int b) {
+            return frecuencia[a] > frecuencia[b];
+        });
+    }
+    // los contadores se limpian solo donde se tocaron
+    for (int v : tocados) frecuencia[v] = 0;
+    if (cap_vprime > 0 && (int)tocados.size() > cap_vprime) {
+        tocados.resize(std::max(cap_vprime, (int)incumbente.size()));
+    }
+    for (int v : tocados) en_vprime[v / 64] |= 1ULL << (v % 64);
+
+    // recorrido del bitset: V' ordenado por id, y queda limpio para la
+    // siguiente llamada
+    V_prime.clear();
+    for (int w = 0; w < W; ++w) {
+        uint64_t palabra = en_vprime[w];
+        while (palabra) {
+            V_prime.push_back(w * 64 + __builtin_ctzll(palabra));
+            palabra &= palabra - 1;
+        }
+        en_vprime[w] = 0;
+    }
+}
 
+/*
+Inyecta una solucion exacta como super_ind reemplazando al peor individuo.
+*/
+void BRKGA::inyectarSolucion(const std::vector<int>& exact_sol) {
     // Creamos un individuo perfecto basado en la solución exacta
-    Individuo super_ind;
-    super_ind.cr.resize(n);
-
     // decoder prioriza valores ALTOS.
     // Nodos en la solución -> valores altos
     // Nodos fuera -> Valores bajos
-    
-    // Se eliminan repetidos
-    std::set<int> solution_set(exact_sol.begin(), exact_sol.end());
-
-    std::uniform_real_distribution<double> noise(0.0, 0.1); 
-
-    for (int i = 0; i < n; ++i) {
-        int nodo_id = i + 1;
-        super_ind.cr[i].second = nodo_id;
-        
-        if (solution_set.count(nodo_id)) {
-            // Es parte de la solución óptima: Damos prioridad alta
-            super_ind.cr[i].first = 0.9 + noise(rng); 
-        } else {
-            // No es parte: Prioridad baja
-            super_ind.cr[i].first = 0.1 + noise(rng); 
-        }
-    }
+    Individuo super_ind = codificar(exact_sol);
 
     // Calcular fitness
-    super_ind.fitness = getFitness(decoder(super_ind));
+    evaluar(super_ind);
 
     // Reemplazamos al peor individuo de la población actual
     // Como está ordenada descendente por fitness, el peor es el último
+    std::sort(poblacion.begin(), poblacion.end());
     poblacion[p - 1] = super_ind;
     
     // Reordenamos para mantener consistencia
@@ -280,20 +730,156 @@ void BRKGA::runBarrakuda() {
     if (super_ind.fitness > best_global_fitness) {
         best_global_fitness = super_ind.fitness;
         best_global = super_ind;
+        gens_sin_mejora = 0;
+        traza.registrar(MEJORA, num_generaciones, num_decodificaciones,
+                        best_global_fitness);
+    }
+}
+
+void BRKGA::runBarrakuda() {
+    // CONSTRUCCIÓN DE V' (Merge)
+    std::vector<int> V_prime;
+    std::vector<int> incumbente; // solucion del mejor individuo, dentro de V'
+    construirVPrime(V_prime, incumbente);
+
+    // Si V_prime es muy pequeño, quizás no vale la pena (opcional)
+    if (V_prime.empty()) return;
+
+    // Un V' ya resuelto a optimalidad (o contenido en uno) no se resuelve
+    // de nuevo; una solucion guardada mejor que la incumbente sirve de inicio
+    std::vector<int> guardada;
+    if (cache->buscar(V_prime, guardada)) {
+        LlamadaExacta acierto = {0, 0.0, 0.0, 0.0};
+        registrarLlamada(num_generaciones, guardada.size(), V_prime.size(),
+                         acierto);
+        inyectarSolucion(guardada);
+        return;
+    }
+    if (guardada.size() > incumbente.size()) incumbente = guardada;
+
+    // Mejor combinacion con los nodos de V'
+    std::vector<int> exact_sol = solveSubInstance(V_prime, incumbente);
+    registrarLlamada(num_generaciones, exact_sol.size(), V_prime.size(),
+                     ultima_llamada);
+    cache->guardar(V_prime, exact_sol, ultima_llamada.gap == 0.0);
+    if (adaptativo) {
+        ajustarBarrakuda(exact_sol.size() - incumbente.size(), exact_sol.size(),
+                         V_prime.size(), ultima_llamada);
+    }
+
+    inyectarSolucion(exact_sol);
+}
+
+/*
+Version asincrona de runBarrakuda: toma una foto de V' y la resuelve en un
+hilo aparte con su propio solver (con CPLEX, un IloEnv por hilo),
+mientras las generaciones siguen. Si todos los slots estan ocupados no se lanza nada.
+*/
+void BRKGA::lanzarBarrakuda() {
+    SolveAsincrono* libre = nullptr;
+    for (auto& slot : slots) {
+        if (!slot.ocupado) {
+            libre = &slot;
+            break;
+        }
+    }
+    if (libre == nullptr) return;
+
+    std::vector<int> V_prime;
+    std::vector<int> incumbente;
+    construirVPrime(V_prime, incumbente);
+    if (V_prime.empty()) return;
+
+    // los aciertos de la cache se inyectan de inmediato, sin usar el slot
+    std::vector<int> guardada;
+    if (cache->buscar(V_prime, guardada)) {
+        LlamadaExacta acierto = {0, 0.0, 0.0, 0.0};
+        registrarLlamada(num_generaciones, guardada.size(), V_prime.size(),
+                         acierto);
+        inyectarSolucion(guardada);
+        return;
+    }
+    if (guardada.size() > incumbente.size()) incumbente = guardada;
+
+    if (!libre->contexto) {
+        libre->contexto = crearSolver(nombre_solver, n, adj);
+    }
+    libre->ocupado = true;
+    libre->generacion = num_generaciones;
+    libre->tam_vprime = V_prime.size();
+    libre->vprime = V_prime;
+    libre->tam_inicio = incumbente.size();
+
+    SubproblemSolver* ctx = libre->contexto.get();
+    if (adaptativo) {
+        ctx->setLimiteTiempo(limiteLlamada());
+    }
+    LlamadaExacta* stats = &libre->stats;
+    libre->resultado = std::async(std::launch::async,
+        [ctx, stats, V_prime, incumbente]() {
+            return ctx->resolver(V_prime, incumbente, *stats);
+        });
+}
+
+/*
+Recoge en el borde de una generacion los solves asincronos terminados (o
+todos, si esperar es true) e inyecta sus soluciones. Una foto de V' es
+obsoleta si se tomo hace mas de max_retraso generaciones; su solucion se
+descarta. Tambien se descarta si no supera al peor individuo actual, porque
+la poblacion pudo haber avanzado mientras el solver trabajaba.
+*/
+void BRKGA::recogerBarrakuda(bool esperar) {
+    for (auto& slot : slots) {
+        if (!slot.ocupado) continue;
+        if (!esperar && slot.resultado.wait_for(std::chrono::seconds(0)) !=
+                            std::future_status::ready) {
+            continue;
+        }
+        std::vector<int> exact_sol = slot.resultado.get();
+        slot.ocupado = false;
+        registrarLlamada(slot.generacion, exact_sol.size(), slot.tam_vprime,
+                         slot.stats);
+        cache->guardar(slot.vprime, exact_sol, slot.stats.gap == 0.0);
+        if (adaptativo) {
+            ajustarBarrakuda(exact_sol.size() - slot.tam_inicio,
+                             exact_sol.size(), slot.tam_vprime, slot.stats);
+        }
+
+        if (num_generaciones - slot.generacion > max_retraso) continue;
+        int peor = p - 1;
+        for (int i = 0; i < p; ++i) {
+            if (poblacion[i].fitness < poblacion[peor].fitness) peor = i;
+        }
+        if ((int)exact_sol.size() <= poblacion[peor].fitness) continue;
+        inyectarSolucion(exact_sol);
     }
 }
 
 std::vector<int> BRKGA::getSolution() {
-  auto start = std::chrono::high_resolution_clock::now();
+  auto start = std::chrono::steady_clock::now();
   auto end = start + std::chrono::seconds(static_cast<int>(s));
+  start_time = start;
+  traza.iniciar(start);
 
   inicializar_poblacion();
   
-  // Contador para controlar la frecuencia (opcional)
-  int generation_count = 0; 
-  int k_frecuencia = 10; // Ejecutar BARRAKUDA cada 10 generaciones
+  // Generacion de la proxima llamada; k_frecuencia la espacia (fija en 10
+  // salvo con el control adaptativo)
+  int proxima_llamada = num_generaciones + 1;
+  bool asincrono = !slots.empty();
+  if (adaptativo) {
+      traza.registrarAjuste(num_generaciones, num_decodificaciones,
+                            k_frecuencia, cap_vprime, limite_exacto);
+  }
 
-  while (std::chrono::high_resolution_clock::now() < end) {
+  // se corta antes si el mejor global ya es optimo demostrado
+  while (std::chrono::steady_clock::now() < end &&
+         best_global_fitness < cota_superior) {
+
+    // Soluciones exactas terminadas se inyectan en el borde de la generacion
+    if (asincrono) {
+        recogerBarrakuda(false);
+    }
     
     // Evolución normal (Cruce, Mutación, Selección)
     generacion(); 
@@ -301,12 +887,39 @@ std::vector<int> BRKGA::getSolution() {
     // Hibridación BARRAKUDA
     // El paper sugiere hacerlo en el bucle principal. 
     // Se puede hacer siempre o cada 'k' generaciones para no saturar con CPLEX.
-    if (generation_count % k_frecuencia == 0) {
-        runBarrakuda(); 
+    if (num_generaciones >= proxima_llamada) {
+        proxima_llamada = num_generaciones + k_frecuencia;
+        if (asincrono) {
+            lanzarBarrakuda();
+        } else {
+            runBarrakuda();
+        }
     }
 
-    generation_count++;
+    controlarEstancamiento();
+  }
+
+  // Se cortan los solves pendientes y se aprovecha lo que alcanzaron
+  if (asincrono) {
+      for (auto& slot : slots) {
+          if (slot.ocupado) slot.contexto->abortar();
+      }
+      recogerBarrakuda(true);
   }
 
+  // reparto del tiempo entre el BRKGA y el solver de sub-instancias
+  double t_total = std::chrono::duration<double>(
+                       std::chrono::steady_clock::now() - start).count();
+  std::cerr << "# exacto solver=" << nombre_solver
+            << " llamadas=" << llamadas_exactas
+            << " t_modelo=" << t_exacto_modelo
+            << " t_solver=" << t_exacto_solver
+            << " cache=" << cache->aciertos() << " t_total=" << t_total
+            << "\n";
+
+  traza.registrar(FIN, num_generaciones, num_decodificaciones,
+                  best_global_fitness);
   return decoder(best_global);
-}
\ No newline at end of file
+}
+
+const Trace &BRKGA::getTrace() const { return traza; }
@@ -2,11 +2,16 @@
 #define BRKGA_CLASS_H
 
 #include <chrono>
+#include <cstdint>
+#include <future>
 #include <random>
 #include <utility>
 #include <vector>
-#include <set> 
-#include <ilcplex/ilocplex.h> 
+#include <memory>
+#include <string>
+#include "cache_subinstancias.h"
+#include "subproblem_solver.h"
+#include "utils/Trace.h"
 
 // tipo de cromosoma: vector de pares (valor double usado para orden/ranking, id
 // entero)
@@ -47,6 +52,26 @@ public:
   // calcula el fitness de una solucion decodifiacada
   int getFitness(std::vector<int> decodified);
 
+  // decodifica y evalua un individuo. Si la busqueda local esta activa, la
+  // solucion mejorada se escribe de vuelta en el cromosoma (lamarckiano)
+  void evaluar(Individuo &ind);
+
+  // activa la busqueda local (1,2)-swap en el decoder. budget: cantidad maxima
+  // de entradas de adyacencia revisadas por decodificacion (0 = desactivada)
+  void setLocalSearch(long budget);
+
+  // activa el control de estancamiento. gens: generaciones sin mejora antes de
+  // actuar (0 = desactivado); div: diversidad minima antes de reiniciar
+  void setStagnation(int gens, double div);
+
+  // siembra una fraccion frac de la poblacion inicial con soluciones de
+  // reducing-peeling, greedy aleatorizado y SA corto (0 = desactivado)
+  void setWarmStart(double frac);
+
+  // cota superior del optimo: getSolution termina antes del tiempo limite si
+  // el mejor global la alcanza
+  void setUpperBound(int cota);
+
   // ejecuta la generacion: crea una nueva poblacion aplicando elite,
   // cruzamiento y mutacion
   void generacion(); // definimos elite, mutados y normales
@@ -54,7 +79,29 @@ public:
   // devuelve la mejor solucion encontrada (decodificada)
   std::vector<int> getSolution();
 
+  // limita V' a los k nodos mas frecuentes en la elite, mas la incumbente
+  // (0 = sin tope)
+  void setVPrimeCap(int k);
+
+  // ajusta en linea frecuencia de BARRAKUDA, tope de |V'| y tiempo limite
+  // segun la mejora por segundo del solver frente a la del BRKGA solo
+  void setAdaptive(bool activo);
+
+  // backend de las sub-instancias de BARRAKUDA (ver subproblem_solver.h)
+  void setSolver(const std::string &nombre);
+
+  // resuelve BARRAKUDA en hilos aparte con hasta en_vuelo solves simultaneos
+  // (0 = sincrono). Soluciones de fotos de V' con mas de max_retraso
+  // generaciones se descartan
+  void setAsync(int en_vuelo, int max_retraso = 50);
+
+  // traza any-time de la ultima ejecucion de getSolution
+  const Trace &getTrace() const;
+
 private:
+  // el micro-benchmark (benchmark.cpp) mide los metodos privados
+  friend struct AccesoBenchmark;
+
   int n;       // tamaño del problema
   int p;       // tamaño de la poblacion
   double pe;   // proporcion de elite
@@ -66,11 +113,95 @@ private:
   std::vector<Individuo> nueva_poblacion; // vector para la siguiente generacion
   std::vector<std::vector<int>> adj;      // grafo (matriz de adyacencia)
   std::mt19937 rng;
+  // adyacencia como filas de bits (vacio si n > 4096): el decoder marca los
+  // vecinos con un OR de palabras en vez de recorrer la lista
+  int palabras;
+  std::vector<uint64_t> filas;
+  template <int WORDS> std::vector<int> seleccionar(const cromosoma &cr) const;
   Individuo best_global;
   int best_global_fitness;
-  std::chrono::high_resolution_clock::time_point start_time;
-  std::vector<int> solveSubInstance(const std::set<int>& V_prime);
+  std::chrono::steady_clock::time_point start_time;
+  Trace traza;               // eventos any-time (mejoras, reinicios, ...)
+  long num_decodificaciones; // llamadas al decoder
+  long ls_budget; // presupuesto de la busqueda local por decodificacion
+
+  // operadores de la generacion (sin evaluar el resultado)
+  Individuo mutante();
+  Individuo cruzar(const Individuo &padre_elite,
+                   const Individuo &padre_no_elite);
+
+  // mejora una solucion maximal con movimientos (1,2)-swap
+  std::vector<int> busquedaLocal(const std::vector<int> &sol);
+  // sube las llaves de los nodos de sol para que el decoder la reproduzca
+  void recodificar(Individuo &ind, const std::vector<int> &sol);
+
+  int num_generaciones;  // generaciones ejecutadas
+  int gens_sin_mejora;   // generaciones desde la ultima mejora del mejor global
+  int stag_gens;         // umbral de estancamiento (0 = desactivado)
+  double min_div;        // diversidad bajo la cual se reinicia en vez de sacudir
+  // desviacion estandar promedio de las llaves de los m mejores individuos
+  double diversidad(int m);
+  // reinicio parcial o shaking de los no elite si la busqueda se estanco
+  void controlarEstancamiento();
+
+  double warm_frac; // fraccion de la poblacion inicial sembrada
+  int cota_superior; // el mejor global no puede superarla
+  // codifica una solucion con llaves altas para sus nodos (como super_ind)
+  Individuo codificar(const std::vector<int> &sol);
+  // heuristicas constructivas usadas para sembrar la poblacion
+  std::vector<int> greedyRand(int k);
+  std::vector<int> saCorto(const std::vector<int> &inicial, int iters);
+  // solver persistente de las sub-instancias, se crea en la primera llamada
+  // a BARRAKUDA con el backend nombre_solver
+  std::unique_ptr<SubproblemSolver> contexto;
+  std::string nombre_solver;
+  LlamadaExacta ultima_llamada; // estadisticas de la ultima llamada exacta
+  // acumulados de todas las llamadas, para comparar backends
+  int llamadas_exactas;
+  double t_exacto_modelo, t_exacto_solver;
+  void registrarLlamada(int generacion, int valor, int tam_vprime,
+                        const LlamadaExacta &stats);
+  // incumbente: solucion factible dentro de V' usada como MIP start
+  std::vector<int> solveSubInstance(const std::vector<int>& V_prime,
+                                    const std::vector<int>& incumbente);
   void runBarrakuda();
+
+  // un solve exacto asincrono con su propio contexto
+  struct SolveAsincrono {
+    std::unique_ptr<SubproblemSolver> contexto;
+    std::future<std::vector<int>> resultado;
+    LlamadaExacta stats;
+    int generacion = 0;  // generacion en que se tomo la foto de V'
+    int tam_vprime = 0;
+    int tam_inicio = 0; // tamaño de la incumbente entregada
+    std::vector<int> vprime; // para guardar el resultado en la cache
+    bool ocupado = false;
+  };
+  std::vector<SolveAsincrono> slots; // vacio = BARRAKUDA sincrono
+  int max_retraso;                   // generaciones antes de descartar una foto
+  // V' como bitset sobre 1..n y cuantas soluciones elite contienen a cada
+  // nodo; ambos quedan en cero entre llamadas
+  std::vector<uint64_t> en_vprime;
+  std::vector<int> frecuencia;
+  int cap_vprime; // tope de |V'| (0 = sin tope)
+  // resultados de llamadas anteriores por V' (aciertos = llamadas ahorradas)
+  std::unique_ptr<CacheSubinstancias> cache;
+  void construirVPrime(std::vector<int>& V_prime, std::vector<int>& incumbente);
+  void inyectarSolucion(const std::vector<int>& exact_sol);
+  void lanzarBarrakuda();
+  void recogerBarrakuda(bool esperar);
+
+  // control adaptativo de BARRAKUDA
+  bool adaptativo;
+  int k_frecuencia;       // generaciones entre llamadas
+  double limite_exacto;   // tiempo limite por llamada (segundos)
+  double tasa_exacta;     // mejora por segundo del solver (media exponencial)
+  double tasa_ga;         // mejora por segundo del BRKGA entre llamadas
+  double t_ultima_llamada; // segundos de la traza al terminar la anterior
+  int fitness_ultima_llamada;
+  double limiteLlamada() const;
+  void ajustarBarrakuda(int ganancia, int valor, int tam_vprime,
+                        const LlamadaExacta &stats);
 };
 
 #endif
\ No newline at end of file
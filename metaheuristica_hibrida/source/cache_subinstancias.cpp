@@ -0,0 +1,104 @@
+#include "cache_subinstancias.h"
+#include <algorithm>
+
+CacheSubinstancias::CacheSubinstancias(int n, size_t capacidad)
+    : W((n + 64) / 64), capacidad(capacidad), consulta((n + 64) / 64, 0),
+      reloj(0), num_aciertos(0) {}
+
+// bitset de V' en consulta y su hash (mezcla splitmix64 de cada palabra)
+uint64_t CacheSubinstancias::cargar(const std::vector<int> &V_prime) {
+  std::fill(consulta.begin(), consulta.end(), 0);
+  for (int v : V_prime)
+    consulta[v / 64] |= 1ULL << (v % 64);
+
+  uint64_t h = 0x9e3779b97f4a7c15ULL;
+  for (int w = 0; w < W; ++w) {
+    uint64_t z = consulta[w] + 0x9e3779b97f4a7c15ULL * (w + 1);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    h ^= z ^ (z >> 31);
+    h = (h << 7) | (h >> 57);
+  }
+  return h;
+}
+
+bool CacheSubinstancias::contiene(const std::vector<uint64_t> &bits,
+                                  const std::vector<int> &sol) const {
+  for (int v : sol)
+    if (!(bits[v / 64] >> (v % 64) & 1))
+      return false;
+  return true;
+}
+
+bool CacheSubinstancias::buscar(const std::vector<int> &V_prime,
+                                std::vector<int> &sol) {
+  sol.clear();
+  uint64_t h = cargar(V_prime);
+  reloj++;
+
+  // V' identico
+  auto it = por_hash.find(h);
+  if (it != por_hash.end() && entradas[it->second].bits == consulta) {
+    Entrada &e = entradas[it->second];
+    e.uso = reloj;
+    sol = e.sol;
+    if (e.optima) {
+      num_aciertos++;
+      return true;
+    }
+  }
+
+  // V' contenido en una entrada optima cuya solucion cae dentro de V'
+  for (Entrada &e : entradas) {
+    if (!contiene(consulta, e.sol))
+      continue;
+    if (e.optima) {
+      bool subconjunto = true;
+      for (int w = 0; w < W && subconjunto; ++w)
+        subconjunto = (consulta[w] & ~e.bits[w]) == 0;
+      if (subconjunto) {
+        e.uso = reloj;
+        sol = e.sol;
+        num_aciertos++;
+        return true;
+      }
+    }
+    if (e.sol.size() > sol.size())
+      sol = e.sol;
+  }
+  return false;
+}
+
+void CacheSubinstancias::guardar(const std::vector<int> &V_prime,
+                                 const std::vector<int> &sol, bool optima) {
+  if (capacidad == 0)
+    return;
+  uint64_t h = cargar(V_prime);
+  reloj++;
+
+  auto it = por_hash.find(h);
+  if (it != por_hash.end() && entradas[it->second].bits == consulta) {
+    Entrada &e = entradas[it->second];
+    e.uso = reloj;
+    if (!e.optima && (optima || sol.size() > e.sol.size())) {
+      e.sol = sol;
+      e.optima = optima;
+    }
+    return;
+  }
+
+  size_t idx = entradas.size();
+  if (entradas.size() < capacidad) {
+    entradas.push_back(Entrada());
+  } else {
+    idx = 0;
+    for (size_t i = 1; i < entradas.size(); ++i)
+      if (entradas[i].uso < entradas[idx].uso)
+        idx = i;
+    auto viejo = por_hash.find(entradas[idx].hash);
+    if (viejo != por_hash.end() && viejo->second == idx)
+      por_hash.erase(viejo);
+  }
+  entradas[idx] = {consulta, sol, optima, h, reloj};
+  por_hash[h] = idx;
+}
@@ -0,0 +1,58 @@
+#ifndef CACHE_SUBINSTANCIAS_H
+#define CACHE_SUBINSTANCIAS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/*
+Cache de resultados de BARRAKUDA. Cuando la poblacion converge, V' casi no
+cambia entre llamadas; cada entrada guarda V' como bitset sobre 1..n, la
+mejor solucion encontrada dentro de V' y si se probo optima. Un V' identico
+se encuentra en O(1) por el hash del bitset; los subconjuntos se buscan
+recorriendo las entradas (pocas, con reemplazo LRU).
+
+Si S es optima para V'' y V' esta contenido en V'' con S dentro de V', S
+tambien es optima para V': esas entradas se devuelven sin resolver nada.
+Una entrada no optima con su solucion dentro de V' sirve como punto de
+partida si supera a la incumbente.
+*/
+class CacheSubinstancias {
+public:
+  CacheSubinstancias(int n, size_t capacidad = 32);
+
+  // busca V' (ids 1..n, sin repetir). Devuelve true si hay una solucion
+  // optima reutilizable y la deja en sol; si no, sol queda con la mejor
+  // solucion conocida dentro de V' (vacia si no hay ninguna)
+  bool buscar(const std::vector<int> &V_prime, std::vector<int> &sol);
+
+  // guarda el resultado de resolver V'; una entrada optima no se pisa
+  void guardar(const std::vector<int> &V_prime, const std::vector<int> &sol,
+               bool optima);
+
+  long aciertos() const { return num_aciertos; }
+
+private:
+  struct Entrada {
+    std::vector<uint64_t> bits; // V'
+    std::vector<int> sol;
+    bool optima;
+    uint64_t hash;
+    long uso; // ultima vez que se leyo o escribio (LRU)
+  };
+
+  int W; // palabras de 64 bits por bitset de n + 1 nodos
+  size_t capacidad;
+  std::vector<Entrada> entradas;
+  std::unordered_map<uint64_t, size_t> por_hash; // hash de V' -> entrada
+  std::vector<uint64_t> consulta; // bitset de la ultima consulta
+  long reloj;
+  long num_aciertos;
+
+  uint64_t cargar(const std::vector<int> &V_prime); // llena consulta
+  bool contiene(const std::vector<uint64_t> &bits,
+                const std::vector<int> &sol) const;
+};
+
+#endif
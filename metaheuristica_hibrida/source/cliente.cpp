@@ -0,0 +1,74 @@
+/*
+Cliente del servidor de evaluaciones (ver servidor.cpp)
+
+Recibe los mismos argumentos que brkga_hibrid, los envia al servidor y
+escribe en stdout la respuesta, de modo que el target-runner de irace lo
+usa en lugar del binario sin otros cambios.
+
+Uso:
+  ./brkga_client [-socket /tmp/brkga_hibrid.sock] <argumentos de brkga_hibrid>
+
+Codigo de salida: 0 si hubo respuesta, 1 si la evaluacion fallo y
+SIN_SERVIDOR (2) si no se pudo conectar (ej. un socket que quedo de un
+servidor muerto); en ese caso no se envio nada y el target-runner puede
+lanzar brkga_hibrid en su lugar.
+*/
+
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+static const int SIN_SERVIDOR = 2;
+
+int main(int argc, char *argv[]) {
+  std::string ruta = "/tmp/brkga_hibrid.sock";
+  int primero = 1;
+  if (argc >= 3 && std::string(argv[1]) == "-socket") {
+    ruta = argv[2];
+    primero = 3;
+  }
+
+  std::string pedido;
+  for (int i = primero; i < argc; i++)
+    pedido += std::string(i > primero ? "\t" : "") + argv[i];
+  pedido += "\n";
+
+  sockaddr_un dir = {};
+  dir.sun_family = AF_UNIX;
+  if (ruta.size() >= sizeof(dir.sun_path)) {
+    std::cerr << "Ruta de socket demasiado larga: " << ruta << "\n";
+    return 1;
+  }
+  std::strcpy(dir.sun_path, ruta.c_str());
+  int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (fd < 0 || connect(fd, (sockaddr *)&dir, sizeof(dir)) != 0) {
+    std::cerr << "No se pudo conectar a " << ruta << "\n";
+    return SIN_SERVIDOR;
+  }
+
+  for (size_t enviado = 0; enviado < pedido.size();) {
+    ssize_t r = write(fd, pedido.data() + enviado, pedido.size() - enviado);
+    if (r <= 0) {
+      std::cerr << "Conexion cerrada por el servidor\n";
+      return 1;
+    }
+    enviado += r;
+  }
+
+  std::string respuesta;
+  char buf[256];
+  for (ssize_t r; (r = read(fd, buf, sizeof(buf))) > 0;)
+    respuesta.append(buf, r);
+  close(fd);
+
+  if (respuesta.empty() || respuesta.compare(0, 5, "ERROR") == 0) {
+    std::cerr << (respuesta.empty() ? "Sin respuesta del servidor\n"
+                                    : respuesta);
+    return 1;
+  }
+  std::cout << respuesta;
+  return 0;
+}
@@ -0,0 +1,176 @@
+#include "contexto_bnb.h"
+#include <algorithm>
+
+ContextoBnB::ContextoBnB(int n, const std::vector<std::vector<int>> &adj,
+                         double limite_tiempo)
+    : n(n), adj(adj), limite_tiempo(limite_tiempo), abortado(false),
+      local(n + 1, -1), m(0), W(0), num_nodos(0), cortado(false) {}
+
+void ContextoBnB::abortar() { abortado = true; }
+
+void ContextoBnB::setLimiteTiempo(double segundos) { limite_tiempo = segundos; }
+
+/*
+Coloreo greedy secuencial con bitsets (BBMC): se toma el primer nodo libre de
+Q, se le asigna el color k y se sacan de la clase sus vecinos del complemento;
+al vaciarse la clase se abre el color k + 1 con lo que queda.
+*/
+void ContextoBnB::colorear(Nivel &nv, int kmin) {
+  nv.U.clear();
+  nv.color.clear();
+  std::vector<uint64_t> Q(nv.P), Qk(W);
+  int restantes = 0;
+  for (int w = 0; w < W; ++w)
+    restantes += __builtin_popcountll(Q[w]);
+
+  int k = 0;
+  while (restantes > 0) {
+    ++k;
+    Qk = Q;
+    for (int w = 0; w < W; ++w) {
+      while (Qk[w]) {
+        int v = w * 64 + __builtin_ctzll(Qk[w]);
+        Q[w] &= ~(1ULL << (v % 64));
+        --restantes;
+        const uint64_t *fila = &comp[(size_t)v * W];
+        for (int z = w; z < W; ++z)
+          Qk[z] &= ~fila[z];
+        Qk[w] &= ~(1ULL << (v % 64));
+        if (k >= kmin) {
+          nv.U.push_back(v);
+          nv.color.push_back(k);
+        }
+      }
+    }
+  }
+}
+
+void ContextoBnB::expandir(int d) {
+  if ((++num_nodos & 1023) == 0 &&
+      (abortado || std::chrono::steady_clock::now() >= limite))
+    cortado = true;
+  if (cortado)
+    return;
+
+  Nivel &nv = niveles[d];
+  colorear(nv, (int)mejor.size() - (int)actual.size() + 1);
+
+  for (int i = (int)nv.U.size() - 1; i >= 0 && !cortado; --i) {
+    // cota de coloreo: ni con un nodo de cada color se supera a la mejor
+    if ((int)actual.size() + nv.color[i] <= (int)mejor.size())
+      return;
+    int v = nv.U[i];
+    actual.push_back(v);
+
+    std::vector<uint64_t> &sig = niveles[d + 1].P;
+    const uint64_t *fila = &comp[(size_t)v * W];
+    bool vacio = true;
+    for (int w = 0; w < W; ++w) {
+      sig[w] = nv.P[w] & fila[w];
+      vacio = vacio && sig[w] == 0;
+    }
+    if (vacio) {
+      if (actual.size() > mejor.size())
+        mejor = actual;
+    } else {
+      expandir(d + 1);
+    }
+
+    actual.pop_back();
+    nv.P[v / 64] &= ~(1ULL << (v % 64));
+  }
+}
+
+std::vector<int> ContextoBnB::resolver(const std::vector<int> &nodos,
+                                       const std::vector<int> &inicio,
+                                       LlamadaExacta &stats) {
+  auto t0 = std::chrono::steady_clock::now();
+  stats = {0, 0.0, 0.0, -1.0};
+
+  // Orden inicial por grado decreciente en el complemento: los nodos de mas
+  // grado quedan en los bits bajos y se colorean primero
+  m = nodos.size();
+  W = (m + 63) / 64;
+  std::vector<int> grado(m);
+  for (int i = 0; i < m; ++i)
+    local[nodos[i]] = i;
+  for (int i = 0; i < m; ++i) {
+    int vecinos = 0;
+    for (int u : adj[nodos[i]])
+      if (local[u] >= 0 && u != nodos[i])
+        ++vecinos;
+    grado[i] = m - 1 - vecinos;
+  }
+  std::vector<int> orden(m);
+  for (int i = 0; i < m; ++i)
+    orden[i] = i;
+  std::stable_sort(orden.begin(), orden.end(),
+                   [&](int a, int b) { return grado[a] > grado[b]; });
+  global.assign(m, 0);
+  for (int i = 0; i < m; ++i) {
+    global[i] = nodos[orden[i]];
+    local[global[i]] = i;
+  }
+
+  // Complemento inducido: todos contra todos menos las aristas de G
+  comp.assign((size_t)m * W, 0);
+  for (int i = 0; i < m; ++i) {
+    uint64_t *fila = &comp[(size_t)i * W];
+    for (int w = 0; w < W; ++w)
+      fila[w] = ~0ULL;
+    if (m % 64)
+      fila[W - 1] = (1ULL << (m % 64)) - 1;
+    fila[i / 64] &= ~(1ULL << (i % 64));
+    for (int u : adj[global[i]])
+      if (local[u] >= 0)
+        fila[local[u] / 64] &= ~(1ULL << (local[u] % 64));
+  }
+
+  // La incumbente es la cota inferior inicial
+  actual.clear();
+  mejor.clear();
+  for (int v : inicio)
+    if (v >= 0 && v <= n && local[v] >= 0)
+      mejor.push_back(local[v]);
+  if (mejor.size() != inicio.size())
+    mejor.clear();
+
+  niveles.resize(m + 2);
+  for (auto &nv : niveles)
+    nv.P.assign(W, 0);
+  for (int i = 0; i < m; ++i)
+    niveles[0].P[i / 64] |= 1ULL << (i % 64);
+
+  auto t1 = std::chrono::steady_clock::now();
+  stats.t_modelo = std::chrono::duration<double>(t1 - t0).count();
+
+  num_nodos = 0;
+  cortado = false;
+  limite = t1 + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                    std::chrono::duration<double>(limite_tiempo));
+  int cota = 0; // numero de colores de la raiz
+  if (m > 0) {
+    colorear(niveles[0], 0);
+    cota = niveles[0].color.back();
+    expandir(0);
+  }
+
+  std::vector<int> solution_mis;
+  for (int v : mejor)
+    solution_mis.push_back(global[v]);
+  if (!solution_mis.empty())
+    stats.gap = cortado ? (double)(cota - (int)solution_mis.size()) /
+                              solution_mis.size()
+                        : 0.0;
+  stats.t_solver =
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - t1)
+          .count();
+
+  for (int v : nodos)
+    local[v] = -1;
+  // un abort pedido antes o durante este solve ya se consumio
+  abortado = false;
+  if (solution_mis.size() < inicio.size())
+    solution_mis = inicio;
+  return solution_mis;
+}
@@ -0,0 +1,67 @@
+#ifndef CONTEXTO_BNB_H
+#define CONTEXTO_BNB_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+#include "subproblem_solver.h"
+
+/*
+Solver exacto propio para las sub-instancias de BARRAKUDA, sin dependencias
+externas. Resuelve el MISP sobre el subgrafo inducido por V' como clique
+maxima en su complemento con un branch & bound estilo MCS/BBMC: los conjuntos
+de candidatos son bitsets y la cota de cada nodo es un coloreo greedy
+bit-paralelo del complemento (cada color es un independiente del complemento,
+es decir, a lo mas un nodo de cada color entra en la clique). Tiene la misma
+interfaz que ContextoCplex: limite de tiempo, solucion inicial como cota
+inferior y abortar() desde otro hilo.
+*/
+class ContextoBnB : public SubproblemSolver {
+public:
+  ContextoBnB(int n, const std::vector<std::vector<int>> &adj,
+              double limite_tiempo = 1.0);
+
+  // resuelve el MISP restringido a nodos (ids 1..n) y devuelve la solucion.
+  // inicio es una solucion factible dentro de nodos: su tamaño es la cota
+  // inferior inicial y se devuelve si la busqueda no la mejora
+  std::vector<int> resolver(const std::vector<int> &nodos,
+                            const std::vector<int> &inicio,
+                            LlamadaExacta &stats) override;
+
+  // interrumpe la resolucion en curso (se puede llamar desde otro hilo)
+  void abortar() override;
+  void setLimiteTiempo(double segundos) override;
+
+private:
+  int n;
+  const std::vector<std::vector<int>> &adj;
+  double limite_tiempo;
+  std::atomic<bool> abortado;
+  std::vector<int> local; // id global -> indice local en V' (-1 fuera)
+
+  // estado de la llamada en curso
+  int m;                     // nodos de V'
+  int W;                     // palabras de 64 bits por fila de m nodos
+  std::vector<int> global;   // indice local -> id global
+  std::vector<uint64_t> comp; // filas del complemento inducido (m * W)
+  std::vector<int> actual, mejor; // clique en construccion y mejor clique
+  long num_nodos;            // nodos del arbol explorados
+  bool cortado;              // se alcanzo el limite de tiempo o se aborto
+  std::chrono::steady_clock::time_point limite;
+
+  // candidatos y coloreo de cada profundidad del arbol
+  struct Nivel {
+    std::vector<uint64_t> P;
+    std::vector<int> U;     // candidatos en orden de color creciente
+    std::vector<int> color; // color de U[i] (cota para U[0..i])
+  };
+  std::vector<Nivel> niveles;
+
+  // colorea P; solo guarda en U los nodos con color >= kmin, los demas no
+  // pueden mejorar la mejor clique por si solos
+  void colorear(Nivel &nv, int kmin);
+  void expandir(int d);
+};
+
+#endif
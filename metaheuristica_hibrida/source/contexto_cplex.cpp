@@ -0,0 +1,191 @@
+#include "contexto_cplex.h"
+#include <chrono>
+
+ILOSTLBEGIN
+
+ContextoCplex::ContextoCplex(int n, const std::vector<std::vector<int>> &adj,
+                             double limite_tiempo)
+    : n(n), adj(adj), W((n + 64) / 64), cubierta((size_t)(n + 1) * W, 0),
+      activo(n + 1, 0), num_filas(0) {
+  model = IloModel(env);
+
+  // Variables: una por cada nodo del grafo, todas fuera de V' al inicio
+  x = IloNumVarArray(env, n + 1, 0, 0, ILOINT);
+  model.add(IloMaximize(env, IloSum(x)));
+
+  cplex = IloCplex(model);
+  cplex.setOut(env.getNullStream()); // Silenciar output
+  cplex.setParam(IloCplex::Param::TimeLimit, limite_tiempo);
+  cplex.setParam(IloCplex::Param::Threads, 1); // Un solo hilo para no saturar
+  aborter = IloCplex::Aborter(env);
+  cplex.use(aborter);
+}
+
+ContextoCplex::~ContextoCplex() { env.end(); }
+
+void ContextoCplex::abortar() { aborter.abort(); }
+
+void ContextoCplex::setLimiteTiempo(double segundos) {
+  cplex.setParam(IloCplex::Param::TimeLimit, segundos);
+}
+
+/*
+Cobertura greedy de las aristas del subgrafo inducido por nodos con cliques.
+Para cada arista (u, v) aun no cubierta se parte de {u, v} y se agregan nodos
+adyacentes a todos los miembros, prefiriendo los que cubren aristas nuevas
+desde u. La adyacencia local se guarda como filas de bits (64 nodos por
+palabra), asi los candidatos se actualizan con un AND por palabra. Las
+aristas cubiertas por filas de llamadas anteriores se marcan desde el inicio.
+*/
+std::vector<std::vector<int>>
+ContextoCplex::cubrirConCliques(const std::vector<int> &nodos) {
+  int m = nodos.size();
+  int Wl = (m + 63) / 64;
+  std::vector<int> local(n + 1, -1);
+  for (int k = 0; k < m; ++k)
+    local[nodos[k]] = k;
+
+  std::vector<uint64_t> ady((size_t)m * Wl, 0), cub((size_t)m * Wl, 0);
+  for (int k = 0; k < m; ++k) {
+    int u = nodos[k];
+    for (int v : adj[u]) {
+      int l = local[v];
+      if (l < 0)
+        continue;
+      ady[(size_t)k * Wl + l / 64] |= 1ULL << (l % 64);
+      if (cubierta[(size_t)u * W + v / 64] >> (v % 64) & 1)
+        cub[(size_t)k * Wl + l / 64] |= 1ULL << (l % 64);
+    }
+  }
+
+  std::vector<std::vector<int>> cliques;
+  std::vector<uint64_t> cand(Wl);
+  for (int u = 0; u < m; ++u) {
+    const uint64_t *Au = &ady[(size_t)u * Wl];
+    uint64_t *Cu = &cub[(size_t)u * Wl];
+    for (int w = 0; w < Wl; ++w) {
+      // aristas (u, v) sin cubrir
+      while (Au[w] & ~Cu[w]) {
+        int v = w * 64 + __builtin_ctzll(Au[w] & ~Cu[w]);
+        std::vector<int> clique = {u, v};
+        const uint64_t *Av = &ady[(size_t)v * Wl];
+        for (int i = 0; i < Wl; ++i)
+          cand[i] = Au[i] & Av[i];
+
+        while (true) {
+          // primero candidatos que cubren una arista nueva desde u
+          int elegido = -1;
+          for (int i = 0; i < Wl && elegido == -1; ++i)
+            if (cand[i] & ~Cu[i])
+              elegido = i * 64 + __builtin_ctzll(cand[i] & ~Cu[i]);
+          for (int i = 0; i < Wl && elegido == -1; ++i)
+            if (cand[i])
+              elegido = i * 64 + __builtin_ctzll(cand[i]);
+          if (elegido == -1)
+            break;
+          clique.push_back(elegido);
+          const uint64_t *Ae = &ady[(size_t)elegido * Wl];
+          for (int i = 0; i < Wl; ++i)
+            cand[i] &= Ae[i];
+        }
+
+        // marcamos como cubiertas todas las aristas del clique
+        for (int a : clique)
+          for (int b : clique)
+            if (a != b)
+              cub[(size_t)a * Wl + b / 64] |= 1ULL << (b % 64);
+        cliques.push_back(clique);
+      }
+    }
+  }
+  return cliques;
+}
+
+std::vector<int> ContextoCplex::resolver(const std::vector<int> &nodos,
+                                         const std::vector<int> &inicio,
+                                         LlamadaExacta &stats) {
+  auto t0 = std::chrono::steady_clock::now();
+  std::vector<int> solution_mis;
+  stats = {num_filas, 0.0, 0.0, -1.0};
+
+  try {
+    // Cotas: 1 dentro de V', 0 fuera. Solo se tocan los nodos que cambian.
+    std::vector<char> nuevo(n + 1, 0);
+    for (int v : nodos)
+      nuevo[v] = 1;
+    for (int v = 1; v <= n; ++v) {
+      if (nuevo[v] != activo[v]) {
+        x[v].setUB(nuevo[v]);
+        activo[v] = nuevo[v];
+      }
+    }
+
+    // Filas de clique para las aristas inducidas aun no cubiertas
+    IloRangeArray filas(env);
+    for (const auto &clique : cubrirConCliques(nodos)) {
+      IloExpr suma(env);
+      for (int k : clique)
+        suma += x[nodos[k]];
+      filas.add(suma <= 1);
+      suma.end();
+
+      for (int a : clique) {
+        for (int b : clique) {
+          int u = nodos[a], v = nodos[b];
+          if (u != v)
+            cubierta[(size_t)u * W + v / 64] |= 1ULL << (v % 64);
+        }
+      }
+    }
+    if (filas.getSize() > 0)
+      model.add(filas);
+    num_filas += filas.getSize();
+    stats.filas = num_filas;
+
+    // MIP start con la incumbente y corte en su tamaño: CPLEX poda de
+    // inmediato todo nodo que no pueda superarla
+    if (cplex.getNMIPStarts() > 0)
+      cplex.deleteMIPStarts(0, cplex.getNMIPStarts());
+    if (!inicio.empty()) {
+      IloNumVarArray vars(env);
+      IloNumArray vals(env);
+      for (int v : inicio) {
+        vars.add(x[v]);
+        vals.add(1.0);
+      }
+      cplex.addMIPStart(vars, vals, IloCplex::MIPStartCheckFeas);
+      vars.end();
+      vals.end();
+    }
+    cplex.setParam(IloCplex::Param::MIP::Tolerances::LowerCutoff,
+                   (double)inicio.size());
+
+    auto t1 = std::chrono::steady_clock::now();
+    stats.t_modelo = std::chrono::duration<double>(t1 - t0).count();
+
+    if (cplex.solve()) {
+      for (int v : nodos)
+        if (cplex.getValue(x[v]) > 0.5)
+          solution_mis.push_back(v);
+      stats.gap = cplex.getStatus() == IloAlgorithm::Optimal
+                      ? 0.0
+                      : cplex.getMIPRelativeGap();
+    } else if (cplex.getStatus() == IloAlgorithm::Infeasible ||
+               cplex.getStatus() == IloAlgorithm::InfeasibleOrUnbounded) {
+      // El modelo siempre es factible (x = 0) y acotado: la infactibilidad
+      // solo puede venir del corte, que podo todo el arbol. Ninguna solucion
+      // supera a la incumbente, que es optima en V'
+      stats.gap = 0.0;
+    }
+    stats.t_solver =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - t1)
+            .count();
+  } catch (...) {
+    // En caso de error de CPLEX, se devuelve la incumbente
+  }
+  // un abort pedido antes o durante este solve ya se consumio
+  aborter.clear();
+  if (solution_mis.size() < inicio.size())
+    solution_mis = inicio;
+  return solution_mis;
+}
@@ -0,0 +1,55 @@
+#ifndef CONTEXTO_CPLEX_H
+#define CONTEXTO_CPLEX_H
+
+#include <cstdint>
+#include <vector>
+#include <ilcplex/ilocplex.h>
+#include "subproblem_solver.h"
+
+/*
+Contexto CPLEX persistente para las sub-instancias de BARRAKUDA. Se crea una
+vez por ejecucion y mantiene el ambiente, el modelo, una variable binaria por
+nodo del grafo y el objeto IloCplex. En cada llamada solo se cambian las cotas
+superiores (1 dentro de V', 0 fuera) y se agregan las filas de clique que
+faltan para cubrir aristas inducidas por V' que ninguna fila anterior cubre.
+Las filas antiguas siguen siendo validas para cualquier V' (los nodos fuera de
+V' valen 0), asi el modelo crece poco a poco y CPLEX reutiliza lo extraido.
+*/
+class ContextoCplex : public SubproblemSolver {
+public:
+  ContextoCplex(int n, const std::vector<std::vector<int>> &adj,
+                double limite_tiempo = 1.0);
+  ~ContextoCplex();
+
+  // resuelve el MISP restringido a nodos (ids 1..n) y devuelve la solucion.
+  // inicio es una solucion factible dentro de nodos: se usa como MIP start y
+  // su tamaño como cota de corte, y se devuelve si CPLEX no la mejora
+  std::vector<int> resolver(const std::vector<int> &nodos,
+                            const std::vector<int> &inicio,
+                            LlamadaExacta &stats) override;
+
+  // interrumpe la resolucion en curso (se puede llamar desde otro hilo)
+  void abortar() override;
+  void setLimiteTiempo(double segundos) override;
+
+private:
+  int n;
+  const std::vector<std::vector<int>> &adj;
+  int W;                          // palabras de 64 bits por fila de n nodos
+  std::vector<uint64_t> cubierta; // aristas (u, v) ya cubiertas por una fila
+  std::vector<char> activo;       // nodos con cota superior 1
+  int num_filas;                  // filas de clique agregadas al modelo
+
+  IloEnv env;
+  IloModel model;
+  IloNumVarArray x;
+  IloCplex cplex;
+  IloCplex::Aborter aborter;
+
+  // cobertura greedy con cliques de las aristas inducidas por nodos que aun
+  // no estan cubiertas; devuelve los cliques en indices locales
+  std::vector<std::vector<int>>
+  cubrirConCliques(const std::vector<int> &nodos);
+};
+
+#endif
@@ -0,0 +1,153 @@
+#include "contexto_ls.h"
+#include <algorithm>
+
+ContextoLS::ContextoLS(int n, const std::vector<std::vector<int>> &adj,
+                       double limite_tiempo)
+    : n(n), adj(adj), limite_tiempo(limite_tiempo), abortado(false),
+      enV(n + 1, 0), inSol(n + 1, 0), tight(n + 1, 0), marca(n + 1, 0),
+      sello(0) {}
+
+void ContextoLS::abortar() { abortado = true; }
+
+void ContextoLS::setLimiteTiempo(double segundos) { limite_tiempo = segundos; }
+
+/*
+Greedy de grado minimo en G[V']: se elige el nodo con menos vecinos dentro
+de V' y se descartan sus vecinos. Los grados no se actualizan (igual que
+greedyDet), el orden se fija al comienzo.
+*/
+std::vector<int> ContextoLS::greedy(const std::vector<int> &nodos) {
+  std::vector<std::pair<int, int>> orden; // (grado en V', nodo)
+  for (int v : nodos) {
+    int grado = 0;
+    for (int u : adj[v])
+      if (enV[u])
+        grado++;
+    orden.push_back({grado, v});
+  }
+  std::sort(orden.begin(), orden.end());
+
+  sello++;
+  std::vector<int> sol;
+  for (auto &par : orden) {
+    int v = par.second;
+    if (marca[v] == sello)
+      continue;
+    sol.push_back(v);
+    marca[v] = sello;
+    for (int u : adj[v])
+      marca[u] = sello;
+  }
+  return sol;
+}
+
+std::vector<int>
+ContextoLS::mejorar(const std::vector<int> &sol,
+                    std::chrono::steady_clock::time_point limite) {
+  auto insertar = [&](int v) {
+    inSol[v] = 1;
+    for (int u : adj[v])
+      tight[u]++;
+  };
+
+  std::vector<int> pendientes(sol.begin(), sol.end());
+  for (int v : sol)
+    insertar(v);
+
+  std::vector<int> libres; // candidatos en V' con tight = 1 alrededor de x
+  for (size_t idx = 0; idx < pendientes.size(); idx++) {
+    if ((idx & 63) == 0 &&
+        (abortado || std::chrono::steady_clock::now() >= limite))
+      break;
+    int x = pendientes[idx];
+    if (!inSol[x])
+      continue;
+
+    libres.clear();
+    for (int v : adj[x])
+      if (enV[v] && !inSol[v] && tight[v] == 1)
+        libres.push_back(v);
+    if (libres.size() < 2)
+      continue;
+
+    // buscamos un par (u, w) de candidatos no adyacentes
+    int u = -1, w = -1;
+    for (size_t a = 0; a + 1 < libres.size() && u == -1; a++) {
+      sello++;
+      for (int v : adj[libres[a]])
+        marca[v] = sello;
+      for (size_t b = a + 1; b < libres.size(); b++) {
+        if (marca[libres[b]] != sello) {
+          u = libres[a];
+          w = libres[b];
+          break;
+        }
+      }
+    }
+    if (u == -1)
+      continue;
+
+    // aplicamos el movimiento: sale x, entran u y w
+    inSol[x] = 0;
+    for (int v : adj[x])
+      tight[v]--;
+    insertar(u);
+    insertar(w);
+    pendientes.push_back(u);
+    pendientes.push_back(w);
+
+    // completamos con los vecinos de x en V' que quedaron libres
+    for (int v : adj[x]) {
+      if (enV[v] && !inSol[v] && tight[v] == 0) {
+        insertar(v);
+        pendientes.push_back(v);
+      }
+    }
+  }
+
+  // se recoge la solucion y se limpian las marcas para la siguiente
+  std::vector<int> mejorada;
+  for (int v : pendientes) {
+    if (inSol[v]) {
+      mejorada.push_back(v);
+      inSol[v] = 0;
+      for (int u : adj[v])
+        tight[u]--;
+    }
+  }
+  return mejorada;
+}
+
+std::vector<int> ContextoLS::resolver(const std::vector<int> &nodos,
+                                      const std::vector<int> &inicio,
+                                      LlamadaExacta &stats) {
+  auto t0 = std::chrono::steady_clock::now();
+  stats = {0, 0.0, 0.0, -1.0};
+  for (int v : nodos)
+    enV[v] = 1;
+
+  std::vector<int> base = greedy(nodos);
+  auto t1 = std::chrono::steady_clock::now();
+  stats.t_modelo = std::chrono::duration<double>(t1 - t0).count();
+
+  auto limite =
+      t1 + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+               std::chrono::duration<double>(limite_tiempo));
+  std::vector<int> solution_mis = mejorar(base, limite);
+  if (!inicio.empty()) {
+    std::vector<int> desde_inicio = mejorar(inicio, limite);
+    if (desde_inicio.size() > solution_mis.size())
+      solution_mis = desde_inicio;
+  }
+  stats.t_solver =
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - t1)
+          .count();
+
+  for (int v : nodos)
+    enV[v] = 0;
+  // un abort pedido antes o durante este solve ya se consumio
+  abortado = false;
+  if (solution_mis.size() < inicio.size())
+    solution_mis = inicio;
+  return solution_mis;
+}
@@ -0,0 +1,46 @@
+#ifndef CONTEXTO_LS_H
+#define CONTEXTO_LS_H
+
+#include <atomic>
+#include <chrono>
+#include <vector>
+#include "subproblem_solver.h"
+
+/*
+Backend heuristico para las sub-instancias de BARRAKUDA: greedy de grado
+minimo sobre el subgrafo inducido por V' y busqueda local (1,2)-swap, tanto
+desde el greedy como desde la incumbente. No prueba optimalidad (el gap se
+reporta como -1); sirve como linea base barata para medir el aporte del
+componente exacto.
+*/
+class ContextoLS : public SubproblemSolver {
+public:
+  ContextoLS(int n, const std::vector<std::vector<int>> &adj,
+             double limite_tiempo = 1.0);
+
+  std::vector<int> resolver(const std::vector<int> &nodos,
+                            const std::vector<int> &inicio,
+                            LlamadaExacta &stats) override;
+  void abortar() override;
+  void setLimiteTiempo(double segundos) override;
+
+private:
+  int n;
+  const std::vector<std::vector<int>> &adj;
+  double limite_tiempo;
+  std::atomic<bool> abortado;
+
+  // marcas por nodo reutilizadas entre llamadas (se limpian al terminar)
+  std::vector<char> enV;   // nodo dentro de V'
+  std::vector<char> inSol; // nodo en la solucion
+  std::vector<int> tight;  // vecinos de cada nodo en la solucion
+  std::vector<int> marca;
+  int sello;
+
+  std::vector<int> greedy(const std::vector<int> &nodos);
+  // (1,2)-swaps restringidos a V' hasta un optimo local o el limite
+  std::vector<int> mejorar(const std::vector<int> &sol,
+                           std::chrono::steady_clock::time_point limite);
+};
+
+#endif
@@ -0,0 +1,127 @@
+#include "ejecucion.h"
+#include "brkga_class.h"
+#include "utils/Kernel.h"
+#include "utils/MaxClique.h"
+#include "utils/ReducingPeeling.h"
+#include "utils/UpperBound.h"
+#include <chrono>
+#include <iostream>
+#include <memory>
+
+bool leerParametros(const std::vector<std::string> &args, Parametros &par,
+                    std::string &filename) {
+  for (size_t i = 0; i < args.size(); i++) {
+    const std::string &arg = args[i];
+    if (arg == "-i")
+      filename = args.at(++i);
+    else if (arg == "-t")
+      par.s = std::stod(args.at(++i));
+    else if (arg == "-p")
+      par.p = std::stoi(args.at(++i));
+    else if (arg == "-pe")
+      par.pe = std::stod(args.at(++i));
+    else if (arg == "-pm")
+      par.pm = std::stod(args.at(++i));
+    else if (arg == "-rhoe")
+      par.rhoe = std::stod(args.at(++i));
+    else if (arg == "-seed")
+      par.seed = std::stoul(args.at(++i));
+    else if (arg == "-ls")
+      par.ls = std::stol(args.at(++i));
+    else if (arg == "-stag")
+      par.stag = std::stoi(args.at(++i));
+    else if (arg == "-div")
+      par.div = std::stod(args.at(++i));
+    else if (arg == "-warm")
+      par.warm = std::stod(args.at(++i));
+    else if (arg == "-trace")
+      par.trace = args.at(++i);
+    else if (arg == "-kernel")
+      par.kernel = std::stoi(args.at(++i));
+    else if (arg == "-dense")
+      par.dense = std::stod(args.at(++i));
+    else if (arg == "-async")
+      par.async = std::stoi(args.at(++i));
+    else if (arg == "-solver")
+      par.solver = args.at(++i);
+    else if (arg == "-vcap")
+      par.vcap = std::stoi(args.at(++i));
+    else if (arg == "-adapt")
+      par.adapt = std::stoi(args.at(++i));
+    else {
+      std::cerr << "Argumento desconocido: " << arg << "\n";
+      return false;
+    }
+  }
+
+  if (!solverDisponible(par.solver)) {
+    std::cerr << "Solver no disponible en esta compilacion: " << par.solver
+              << "\n";
+    return false;
+  }
+  return true;
+}
+
+int resolver(int V, std::vector<std::vector<int>> adj, const Parametros &par) {
+  // densidad de la instancia (antes del kernel): decide el motor
+  double densidad = MaxClique::density(V, adj);
+
+  // --- Kernel opcional: el BRKGA trabaja sobre el grafo reducido ---
+  std::unique_ptr<Kernel> K;
+  if (par.kernel) {
+    K.reset(new Kernel(V, adj));
+    std::cerr << "# kernel n=" << V << " k=" << K->size()
+              << " m=" << K->edges() << " fijos=" << K->offset()
+              << " t=" << K->seconds() << "\n";
+    if (K->size() == 0) {
+      // las reducciones resolvieron el grafo completo
+      return K->offset();
+    }
+    adj = K->graph();
+    V = K->size();
+  }
+
+  std::vector<int> independentSet;
+  if (par.dense > 0 && densidad >= par.dense) {
+    // --- Grafo denso: el MIS es chico y el complemento ralo, se resuelve
+    // exacto como clique maxima del complemento partiendo de reducing-peeling
+    // (la traza registra la solucion inicial y cada mejora de la busqueda en
+    // el momento en que ocurren)
+    Trace traza;
+    traza.iniciar(std::chrono::steady_clock::now());
+    std::vector<int> inicial = reducingPeeling(V, adj);
+    traza.registrar(MEJORA, 0, 0, inicial.size());
+    MaxClique mc(V, adj);
+    mc.onImprove([&](int tam) { traza.registrar(MEJORA, 0, 0, tam); });
+    independentSet = mc.solve(inicial, par.s);
+    traza.registrar(FIN, 0, 0, independentSet.size());
+    std::cerr << "# denso d=" << densidad
+              << " ub=" << mc.bound() + (K ? K->offset() : 0)
+              << " optimo=" << mc.optimal() << " nodos=" << mc.nodes()
+              << " t=" << traza.segundos() << "\n";
+    if (!par.trace.empty())
+      traza.volcar(par.trace, K ? K->offset() : 0);
+  } else {
+    // --- BRKGA Algorithm ---
+    BRKGA brkga(V, par.p, par.pe, par.pm, par.rhoe, par.s, adj, par.seed);
+    brkga.setLocalSearch(par.ls);
+    brkga.setStagnation(par.stag, par.div);
+    brkga.setWarmStart(par.warm);
+    brkga.setSolver(par.solver);
+    brkga.setVPrimeCap(par.vcap);
+    brkga.setAdaptive(par.adapt != 0);
+    brkga.setAsync(par.async);
+
+    // cota superior sobre el grafo (o kernel) que resuelve el BRKGA
+    UpperBound cota(V, adj);
+    std::cerr << "# cota ub=" << cota.value() + (K ? K->offset() : 0)
+              << " t=" << cota.seconds() << "\n";
+    brkga.setUpperBound(cota.value());
+    independentSet = brkga.getSolution();
+    if (!par.trace.empty())
+      brkga.getTrace().volcar(par.trace, K ? K->offset() : 0);
+  }
+  if (K)
+    independentSet = K->lift(independentSet);
+  return independentSet.size();
+}
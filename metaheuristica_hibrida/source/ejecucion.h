@@ -0,0 +1,47 @@
+#ifndef EJECUCION_H
+#define EJECUCION_H
+
+#include <string>
+#include <vector>
+#include "subproblem_solver.h"
+
+// parametros de una ejecucion (linea de comandos, trabajo del manifiesto o
+// pedido al servidor de evaluaciones)
+struct Parametros {
+  /*
+  s = segundos
+  p = tamaño población
+  pe = población elite
+  pm = población mutante
+  rhoe = probabilidad de heredar del elite
+  */
+  double s = 0, pe = 0, pm = 0, rhoe = 0;
+  int p = 0;
+  unsigned int seed = 0;
+  long ls = 0; // presupuesto de busqueda local (0 = sin busqueda local)
+  int stag = 0;      // generaciones sin mejora antes de reiniciar (0 = nunca)
+  double div = 0.05; // diversidad minima antes de reiniciar
+  double warm = 0.0; // fraccion de la poblacion inicial sembrada
+  std::string trace; // archivo de traza any-time (.csv = todos los eventos)
+  int kernel = 0;    // 1 = reducir el grafo antes (utils/Kernel)
+  // desde esta densidad de la instancia se resuelve exacto como clique
+  // maxima del complemento (utils/MaxClique) en vez del BRKGA (0 = nunca).
+  // 0.65 deja margen al ruido de muestreo de las instancias con p = 0.7
+  double dense = 0.65;
+  int async = 0;     // solves BARRAKUDA simultaneos en segundo plano (0 = no)
+  std::string solver = solverPorDefecto(); // backend de las sub-instancias
+  int vcap = 0; // tope de nodos de V' (0 = sin tope)
+  int adapt = 0; // control adaptativo de BARRAKUDA (0 = cadencia fija)
+};
+
+// lee los parametros de args; -i (filename) solo se usa en la linea de
+// comandos
+bool leerParametros(const std::vector<std::string> &args, Parametros &par,
+                    std::string &filename);
+
+// resuelve el grafo ya cargado y devuelve el tamaño del conjunto
+// independiente encontrado. Usada por la linea de comandos, el modo batch y
+// el servidor de evaluaciones
+int resolver(int V, std::vector<std::vector<int>> adj, const Parametros &par);
+
+#endif
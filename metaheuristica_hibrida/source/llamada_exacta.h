@@ -0,0 +1,12 @@
+#ifndef LLAMADA_EXACTA_H
+#define LLAMADA_EXACTA_H
+
+// estadisticas de una llamada al solver exacto
+struct LlamadaExacta {
+  int filas;       // restricciones del modelo (0 si el solver no usa modelo)
+  double t_modelo; // preparacion del modelo (cotas y filas nuevas)
+  double t_solver; // resolucion
+  double gap;      // gap final (0 = optimo, -1 = sin solucion o sin cota)
+};
+
+#endif
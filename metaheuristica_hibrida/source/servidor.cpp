@@ -0,0 +1,247 @@
+/*
+Servidor de evaluaciones para el tuning con irace
+
+Escucha en un socket Unix local y resuelve cada pedido en un pool de hilos
+trabajadores, sin lanzar un proceso por evaluacion: los grafos se leen una
+sola vez y quedan en una cache indexada por ruta. El cliente (cliente.cpp)
+reemplaza al binario en el target-runner.
+
+Protocolo (una conexion por evaluacion): el cliente envia una linea con los
+mismos argumentos que brkga_hibrid recibe por linea de comandos separados
+por tabuladores; el servidor responde una linea con el valor que imprimiria
+brkga_hibrid (el tamaño negado, irace minimiza) o "ERROR <motivo>". Una
+conexion que no envia la linea completa en ESPERA_PEDIDO segundos se cierra
+sin respuesta, para que no retenga a un trabajador.
+
+Uso:
+  ./brkga_server [-socket /tmp/brkga_hibrid.sock] [-workers <N>]
+*/
+
+#include "ejecucion.h"
+#include "utils/GraphReader.h"
+#include <cerrno>
+#include <condition_variable>
+#include <csignal>
+#include <cstring>
+#include <future>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <sstream>
+#include <string>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+
+const int ESPERA_PEDIDO = 10; // segundos para recibir la linea del pedido
+
+struct Grafo {
+  int n = 0;
+  std::vector<std::vector<int>> adj;
+  bool ok = false;
+};
+
+/*
+Cache de grafos por ruta. El primer pedido de una ruta la carga; los pedidos
+simultaneos de la misma ruta esperan esa carga en vez de repetirla, y los de
+otras rutas no se bloquean.
+*/
+class CacheGrafos {
+public:
+  std::shared_ptr<const Grafo> obtener(const std::string &ruta) {
+    std::promise<std::shared_ptr<const Grafo>> carga;
+    std::shared_future<std::shared_ptr<const Grafo>> futuro;
+    bool cargar = false;
+    {
+      std::lock_guard<std::mutex> lock(mtx);
+      auto it = grafos.find(ruta);
+      if (it == grafos.end()) {
+        futuro = carga.get_future().share();
+        grafos.emplace(ruta, futuro);
+        cargar = true;
+      } else {
+        futuro = it->second;
+      }
+    }
+    if (cargar) {
+      auto g = std::make_shared<Grafo>();
+      try {
+        g->ok = GraphReader::loadFromFile(ruta, g->n, g->adj);
+      } catch (const std::exception &) {
+        // ej. bad_alloc: los que esperan esta carga reciben el error
+        g->adj.clear();
+        g->ok = false;
+      }
+      carga.set_value(g);
+      if (!g->ok) {
+        // no se guarda el error: el archivo puede aparecer despues
+        std::lock_guard<std::mutex> lock(mtx);
+        grafos.erase(ruta);
+      }
+    }
+    return futuro.get();
+  }
+
+private:
+  std::mutex mtx;
+  std::map<std::string, std::shared_future<std::shared_ptr<const Grafo>>>
+      grafos;
+};
+
+// conexiones aceptadas a la espera de un trabajador
+class ColaConexiones {
+public:
+  void agregar(int fd) {
+    {
+      std::lock_guard<std::mutex> lock(mtx);
+      cola.push(fd);
+    }
+    cv.notify_one();
+  }
+  int tomar() {
+    std::unique_lock<std::mutex> lock(mtx);
+    cv.wait(lock, [&] { return !cola.empty(); });
+    int fd = cola.front();
+    cola.pop();
+    return fd;
+  }
+
+private:
+  std::mutex mtx;
+  std::condition_variable cv;
+  std::queue<int> cola;
+};
+
+std::string ruta_socket;
+
+void terminar(int) {
+  unlink(ruta_socket.c_str());
+  _exit(0);
+}
+
+bool leerLinea(int fd, std::string &linea) {
+  char c;
+  while (true) {
+    ssize_t r = read(fd, &c, 1);
+    if (r <= 0)
+      return false;
+    if (c == '\n')
+      return true;
+    linea += c;
+  }
+}
+
+void escribir(int fd, const std::string &texto) {
+  size_t enviado = 0;
+  while (enviado < texto.size()) {
+    ssize_t r = write(fd, texto.data() + enviado, texto.size() - enviado);
+    if (r <= 0)
+      return; // el cliente se fue (SIGPIPE ignorada)
+    enviado += r;
+  }
+}
+
+// atiende un pedido y devuelve la linea de respuesta
+std::string evaluar(const std::string &pedido, CacheGrafos &cache) {
+  std::vector<std::string> args;
+  std::stringstream ss(pedido);
+  for (std::string a; std::getline(ss, a, '\t');)
+    if (!a.empty())
+      args.push_back(a);
+
+  Parametros par;
+  std::string filename;
+  try {
+    if (!leerParametros(args, par, filename))
+      return "ERROR parametros invalidos";
+  } catch (const std::exception &) {
+    return "ERROR parametros invalidos";
+  }
+  if (filename.empty() || par.s <= 0 || par.p <= 0)
+    return "ERROR faltan -i, -t o -p";
+
+  std::shared_ptr<const Grafo> g = cache.obtener(filename);
+  if (!g->ok)
+    return "ERROR no se pudo leer " + filename;
+  // una excepcion (ej. bad_alloc en un grafo grande) no debe salir del hilo
+  // trabajador: terminaria el servidor con todas las evaluaciones en curso
+  try {
+    return std::to_string(-resolver(g->n, g->adj, par));
+  } catch (const std::exception &e) {
+    return std::string("ERROR ") + e.what();
+  } catch (...) {
+    return "ERROR excepcion no estandar en resolver"; // ej. IloException
+  }
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  ruta_socket = "/tmp/brkga_hibrid.sock";
+  int workers = std::thread::hardware_concurrency();
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    if (arg == "-socket" && i + 1 < argc)
+      ruta_socket = argv[++i];
+    else if (arg == "-workers" && i + 1 < argc)
+      workers = std::stoi(argv[++i]);
+    else {
+      std::cerr << "Uso: ./brkga_server [-socket <ruta>] [-workers <N>]\n";
+      return 1;
+    }
+  }
+  if (workers < 1)
+    workers = 1;
+
+  sockaddr_un dir = {};
+  dir.sun_family = AF_UNIX;
+  if (ruta_socket.size() >= sizeof(dir.sun_path)) {
+    std::cerr << "Ruta de socket demasiado larga: " << ruta_socket << "\n";
+    return 1;
+  }
+  std::strcpy(dir.sun_path, ruta_socket.c_str());
+
+  int servidor = socket(AF_UNIX, SOCK_STREAM, 0);
+  unlink(ruta_socket.c_str()); // socket de una ejecucion anterior
+  if (servidor < 0 || bind(servidor, (sockaddr *)&dir, sizeof(dir)) != 0 ||
+      listen(servidor, 128) != 0) {
+    std::cerr << "No se pudo escuchar en " << ruta_socket << ": "
+              << std::strerror(errno) << "\n";
+    return 1;
+  }
+  std::signal(SIGPIPE, SIG_IGN);
+  std::signal(SIGINT, terminar);
+  std::signal(SIGTERM, terminar);
+  std::cerr << "# servidor socket=" << ruta_socket << " workers=" << workers
+            << "\n";
+
+  CacheGrafos cache;
+  ColaConexiones cola;
+  std::vector<std::thread> hilos;
+  for (int w = 0; w < workers; ++w)
+    hilos.emplace_back([&] {
+      while (true) {
+        int fd = cola.tomar();
+        std::string pedido;
+        if (leerLinea(fd, pedido))
+          escribir(fd, evaluar(pedido, cache) + "\n");
+        close(fd);
+      }
+    });
+
+  while (true) {
+    int fd = accept(servidor, nullptr, nullptr);
+    if (fd < 0)
+      continue;
+    timeval espera = {ESPERA_PEDIDO, 0};
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &espera, sizeof(espera));
+    cola.agregar(fd);
+  }
+}
@@ -0,0 +1,37 @@
+#include "subproblem_solver.h"
+#include "contexto_bnb.h"
+#include "contexto_ls.h"
+#ifdef USE_CPLEX
+#include "contexto_cplex.h"
+#endif
+
+bool solverDisponible(const std::string &nombre) {
+#ifdef USE_CPLEX
+  if (nombre == "cplex")
+    return true;
+#endif
+  return nombre == "bnb" || nombre == "ls";
+}
+
+std::string solverPorDefecto() {
+#ifdef USE_CPLEX
+  return "cplex";
+#else
+  return "bnb";
+#endif
+}
+
+std::unique_ptr<SubproblemSolver>
+crearSolver(const std::string &nombre, int n,
+            const std::vector<std::vector<int>> &adj, double limite_tiempo) {
+  std::unique_ptr<SubproblemSolver> solver;
+#ifdef USE_CPLEX
+  if (nombre == "cplex")
+    solver.reset(new ContextoCplex(n, adj, limite_tiempo));
+#endif
+  if (nombre == "bnb")
+    solver.reset(new ContextoBnB(n, adj, limite_tiempo));
+  else if (nombre == "ls")
+    solver.reset(new ContextoLS(n, adj, limite_tiempo));
+  return solver;
+}
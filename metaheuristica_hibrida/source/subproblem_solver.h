@@ -0,0 +1,45 @@
+#ifndef SUBPROBLEM_SOLVER_H
+#define SUBPROBLEM_SOLVER_H
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "llamada_exacta.h"
+
+/*
+Interfaz de los solvers de sub-instancias de BARRAKUDA. Cada implementacion
+se crea una vez por hilo y se reutiliza entre llamadas, asi puede guardar
+estado (modelo, memoria) de una llamada a la siguiente.
+*/
+class SubproblemSolver {
+public:
+  virtual ~SubproblemSolver() {}
+
+  // resuelve el MISP restringido a nodos (ids 1..n) y devuelve la solucion.
+  // inicio es una solucion factible dentro de nodos; nunca se devuelve algo
+  // peor que inicio
+  virtual std::vector<int> resolver(const std::vector<int> &nodos,
+                                    const std::vector<int> &inicio,
+                                    LlamadaExacta &stats) = 0;
+
+  // interrumpe la resolucion en curso (se puede llamar desde otro hilo)
+  virtual void abortar() = 0;
+
+  // cambia el tiempo limite de las proximas llamadas (no de la que corre)
+  virtual void setLimiteTiempo(double segundos) = 0;
+};
+
+// backends: "cplex" (solo si se compilo con USE_CPLEX), "bnb" (branch &
+// bound propio) y "ls" (greedy + busqueda local, sin prueba de optimalidad)
+bool solverDisponible(const std::string &nombre);
+
+// backend usado si no se pide otro: cplex si esta compilado, si no bnb
+std::string solverPorDefecto();
+
+// crea el backend pedido; nullptr si no esta disponible
+std::unique_ptr<SubproblemSolver>
+crearSolver(const std::string &nombre, int n,
+            const std::vector<std::vector<int>> &adj,
+            double limite_tiempo = 1.0);
+
+#endif
@@ -0,0 +1,75 @@
+#ifndef FIXEDBITSET_H
+#define FIXEDBITSET_H
+
+#include <cstdint>
+#include <type_traits>
+
+/*
+Bitset kernels with a compile-time word count. WORDS > 0 fixes the width so
+the loops over 16/32/47 words (n = 1000/2000/3000) unroll and vectorize;
+WORDS = 0 is the fallback that reads the width at run time. Callers write
+their hot loop once as a template on WORDS and pick the instance with
+dispatchWidth() after loading the graph.
+*/
+namespace bits {
+
+template <int WORDS> inline int width(int dynamic) {
+  return WORDS > 0 ? WORDS : dynamic;
+}
+
+inline bool test(const uint64_t *a, int v) { return a[v / 64] >> (v % 64) & 1; }
+inline void set(uint64_t *a, int v) { a[v / 64] |= 1ULL << (v % 64); }
+inline void reset(uint64_t *a, int v) { a[v / 64] &= ~(1ULL << (v % 64)); }
+
+template <int WORDS> inline void clear(uint64_t *a, int dynamic) {
+  const int W = width<WORDS>(dynamic);
+  for (int w = 0; w < W; w++)
+    a[w] = 0;
+}
+
+template <int WORDS>
+inline void orInto(uint64_t *dst, const uint64_t *src, int dynamic) {
+  const int W = width<WORDS>(dynamic);
+  for (int w = 0; w < W; w++)
+    dst[w] |= src[w];
+}
+
+// dst = a & b; returns true when the result is empty
+template <int WORDS>
+inline bool andOf(uint64_t *dst, const uint64_t *a, const uint64_t *b,
+                  int dynamic) {
+  const int W = width<WORDS>(dynamic);
+  uint64_t any = 0;
+  for (int w = 0; w < W; w++) {
+    dst[w] = a[w] & b[w];
+    any |= dst[w];
+  }
+  return any == 0;
+}
+
+template <int WORDS> inline int count(const uint64_t *a, int dynamic) {
+  const int W = width<WORDS>(dynamic);
+  int c = 0;
+  for (int w = 0; w < W; w++)
+    c += __builtin_popcountll(a[w]);
+  return c;
+}
+
+// calls f(std::integral_constant<int, WORDS>) with the specialised width
+// for the instance sizes of the repository, or WORDS = 0 otherwise
+template <typename F> inline auto dispatchWidth(int words, F &&f) {
+  switch (words) {
+  case 16:
+    return f(std::integral_constant<int, 16>());
+  case 32:
+    return f(std::integral_constant<int, 32>());
+  case 47:
+    return f(std::integral_constant<int, 47>());
+  default:
+    return f(std::integral_constant<int, 0>());
+  }
+}
+
+} // namespace bits
+
+#endif
@@ -0,0 +1,171 @@
+#include "MaxClique.h"
+#include "FixedBitset.h"
+#include <algorithm>
+
+double MaxClique::density(int n, const std::vector<std::vector<int>> &adj) {
+  if (n < 2)
+    return 0.0;
+  long long m = 0;
+  for (int v = 0; v < n; v++)
+    for (int u : adj[v])
+      if (u >= 0 && u < n && u != v)
+        m++;
+  return (double)m / ((double)n * (n - 1));
+}
+
+MaxClique::MaxClique(int n, const std::vector<std::vector<int>> &adj)
+    : n(n), W((n + 63) / 64), original(n), upper(0), openBound(0), cut(false),
+      numNodes(0) {
+  std::vector<int> degree(n + 1, 0), local(n + 1, -1);
+  std::vector<char> seen(n + 1, 0);
+  for (int v = 1; v <= n; v++) {
+    int neighbours = 0;
+    for (int u : adj[v])
+      if (u >= 1 && u <= n && u != v && !seen[u]) {
+        seen[u] = 1;
+        neighbours++;
+      }
+    for (int u : adj[v])
+      if (u >= 1 && u <= n)
+        seen[u] = 0;
+    degree[v] = n - 1 - neighbours; // degree in the complement
+  }
+  for (int i = 0; i < n; i++)
+    original[i] = i + 1;
+  std::stable_sort(original.begin(), original.end(),
+                   [&](int a, int b) { return degree[a] > degree[b]; });
+  for (int i = 0; i < n; i++)
+    local[original[i]] = i;
+
+  // complement: every pair except the edges of G
+  comp.assign((size_t)n * W, 0);
+  for (int i = 0; i < n; i++) {
+    uint64_t *row = &comp[(size_t)i * W];
+    for (int w = 0; w < W; w++)
+      row[w] = ~0ULL;
+    if (n % 64)
+      row[W - 1] = (1ULL << (n % 64)) - 1;
+    row[i / 64] &= ~(1ULL << (i % 64));
+    for (int u : adj[original[i]])
+      if (u >= 1 && u <= n)
+        row[local[u] / 64] &= ~(1ULL << (local[u] % 64));
+  }
+}
+
+MaxClique::Level MaxClique::newLevel() const {
+  return {std::vector<uint64_t>(W, 0), {}, {}, std::vector<uint64_t>(2 * W)};
+}
+
+/*
+Greedy sequential colouring over bitsets: the first free vertex of Q takes
+colour k and its complement neighbours leave the colour class; when the
+class is empty colour k + 1 opens with what is left. Only vertices with
+colour >= kmin are kept, the others cannot improve the best clique.
+*/
+template <int WORDS> void MaxClique::colorSort(Level &lv, int kmin) {
+  const int Wn = bits::width<WORDS>(W);
+  lv.U.clear();
+  lv.color.clear();
+  uint64_t *Q = lv.work.data(), *Qk = Q + Wn;
+  for (int w = 0; w < Wn; w++)
+    Q[w] = lv.P[w];
+  int left = bits::count<WORDS>(Q, W);
+
+  int k = 0;
+  while (left > 0) {
+    k++;
+    for (int w = 0; w < Wn; w++)
+      Qk[w] = Q[w];
+    for (int w = 0; w < Wn; w++) {
+      while (Qk[w]) {
+        int v = w * 64 + __builtin_ctzll(Qk[w]);
+        Q[w] &= ~(1ULL << (v % 64));
+        left--;
+        const uint64_t *row = &comp[(size_t)v * Wn];
+        for (int z = w; z < Wn; z++)
+          Qk[z] &= ~row[z];
+        Qk[w] &= ~(1ULL << (v % 64));
+        if (k >= kmin) {
+          lv.U.push_back(v);
+          lv.color.push_back(k);
+        }
+      }
+    }
+  }
+}
+
+template <int WORDS> void MaxClique::expand(int d) {
+  const int Wn = bits::width<WORDS>(W);
+  if ((++numNodes & 1023) == 0 &&
+      std::chrono::steady_clock::now() >= deadline)
+    cut = true;
+
+  Level &lv = levels[d];
+  colorSort<WORDS>(lv, (int)best.size() - (int)current.size() + 1);
+
+  for (int i = (int)lv.U.size() - 1; i >= 0; i--) {
+    // colour bound: one vertex per colour cannot beat the best
+    int roof = (int)current.size() + lv.color[i];
+    if (roof <= (int)best.size())
+      return;
+    if (cut) {
+      // U[0..i] stay open, all bounded by roof
+      openBound = std::max(openBound, roof);
+      return;
+    }
+    int v = lv.U[i];
+    current.push_back(v);
+
+    // capacity is reserved in solve(), so lv survives the push_back
+    if ((int)levels.size() <= d + 1)
+      levels.push_back(newLevel());
+    Level &nx = levels[d + 1];
+    if (bits::andOf<WORDS>(nx.P.data(), lv.P.data(), &comp[(size_t)v * Wn],
+                           W)) {
+      if (current.size() > best.size()) {
+        best = current;
+        if (improved)
+          improved((int)best.size());
+      }
+    } else {
+      expand<WORDS>(d + 1);
+    }
+
+    current.pop_back();
+    bits::reset(lv.P.data(), v);
+  }
+}
+
+std::vector<int> MaxClique::solve(const std::vector<int> &initial,
+                                  double seconds) {
+  deadline = std::chrono::steady_clock::now() +
+             std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                 std::chrono::duration<double>(seconds));
+  std::vector<int> local(n + 1, -1);
+  for (int i = 0; i < n; i++)
+    local[original[i]] = i;
+  best.clear();
+  for (int v : initial)
+    if (v >= 1 && v <= n)
+      best.push_back(local[v]);
+  current.clear();
+  cut = false;
+  openBound = 0;
+  numNodes = 0;
+
+  levels.clear();
+  levels.reserve(n + 2); // depth <= alpha + 1
+  levels.push_back(newLevel());
+  for (int i = 0; i < n; i++)
+    bits::set(levels[0].P.data(), i);
+  if (n > 0)
+    bits::dispatchWidth(
+        W, [&](auto words) { expand<decltype(words)::value>(0); });
+
+  upper = cut ? std::max((int)best.size(), openBound) : (int)best.size();
+  std::vector<int> solution;
+  for (int v : best)
+    solution.push_back(original[v]);
+  std::sort(solution.begin(), solution.end());
+  return solution;
+}
@@ -0,0 +1,69 @@
+#ifndef MAXCLIQUE_H
+#define MAXCLIQUE_H
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+/*
+Exact maximum independent set for dense graphs, solved as a maximum clique
+of the complement (which is sparse when G is dense). Branch & bound in the
+style of BBMC: candidate sets are bitsets over the complement rows and every
+node is bounded by a bit-parallel greedy colouring (one vertex per colour at
+most). Vertices are renumbered by decreasing complement degree so the
+colouring sees the constrained vertices first. The search is instantiated
+for the word count of the graph (utils/FixedBitset.h).
+
+With a time limit the search stops with the best solution found and a valid
+upper bound (open branches contribute their colour bound).
+
+Vertices are 1..n and index 0 is ignored, as in the rest of the solvers.
+*/
+class MaxClique {
+public:
+  MaxClique(int n, const std::vector<std::vector<int>> &adj);
+
+  // initial: independent set used as the starting lower bound
+  std::vector<int> solve(const std::vector<int> &initial, double seconds);
+
+  // called with the new size every time the search improves the best set
+  // (e.g. to timestamp it in an any-time trace)
+  void onImprove(std::function<void(int)> callback) {
+    improved = std::move(callback);
+  }
+
+  int bound() const { return upper; } // upper bound on alpha(G)
+  bool optimal() const { return !cut; }
+  long nodes() const { return numNodes; }
+
+  // edge density of the instance as read by GraphReader, over the file's ids
+  // 0..n-1 (the nominal p of the generator). Not for kernel graphs (1..n)
+  static double density(int n, const std::vector<std::vector<int>> &adj);
+
+private:
+  int n, W;
+  std::vector<int> original; // local index -> vertex id
+  std::vector<uint64_t> comp; // complement rows (n * W)
+
+  std::vector<int> current, best; // local indices
+  int upper, openBound;
+  bool cut;
+  long numNodes;
+  std::chrono::steady_clock::time_point deadline;
+  std::function<void(int)> improved;
+
+  struct Level {
+    std::vector<uint64_t> P;
+    std::vector<int> U;     // candidates in increasing colour order
+    std::vector<int> color; // colour of U[i] (bound for U[0..i])
+    std::vector<uint64_t> work; // colouring scratch (2 * W)
+  };
+  std::vector<Level> levels;
+  Level newLevel() const;
+
+  template <int WORDS> void colorSort(Level &lv, int kmin);
+  template <int WORDS> void expand(int d);
+};
+
+#endif
@@ -1,52 +1,180 @@
 #include "brkga_class.h"
+#include "utils/Batch.h"
 #include "utils/GraphReader.h"
+#include "utils/Kernel.h"
+#include "utils/MaxClique.h"
+#include "utils/ReducingPeeling.h"
+#include "utils/UpperBound.h"
+#include <chrono>
 #include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
 
-int main(int argc, char *argv[]) {
-
+// parametros de una ejecucion (linea de comandos o trabajo del manifiesto)
+struct Parametros {
   /*
+  s = segundos
   p = tamaño población
   pe = población elite
   pm = población mutante
   rhoe = probabilidad de heredar del elite
   */
-
-  // Graph reading:
-  if (argc != 15) {
-    std::cerr << "Uso: ./brkga -i <instancia.txt> -t <tiempoSegundos> "
-                 "-p <poblacion> -pe <elite> -pm <mutantes> -rhoe <herencia> "
-                 "-seed <semilla>\n";
-    return 1;
-  }
-
-  std::string filename;
   double s = 0, pe = 0, pm = 0, rhoe = 0;
   int p = 0;
   unsigned int seed = 0;
-
-  // --- Leer argumentos ---
-  for (int i = 1; i < argc; i++) {
-    std::string arg = argv[i];
+  long ls = 0; // presupuesto de busqueda local (0 = sin busqueda local)
+  int stag = 0;      // generaciones sin mejora antes de reiniciar (0 = nunca)
+  double div = 0.05; // diversidad minima antes de reiniciar
+  double warm = 0.0; // fraccion de la poblacion inicial sembrada
+  std::string trace; // archivo de traza any-time (.csv = todos los eventos)
+  int kernel = 0;    // 1 = reducir el grafo antes (utils/Kernel)
+  // desde esta densidad de la instancia se resuelve exacto como clique
+  // maxima del complemento (utils/MaxClique) en vez del BRKGA (0 = nunca).
+  // 0.65 deja margen al ruido de muestreo de las instancias con p = 0.7
+  double dense = 0.65;
+};
+
+// lee los parametros de args; -i (filename) solo se usa en la linea de
+// comandos
+bool leerParametros(const std::vector<std::string> &args, Parametros &par,
+                    std::string &filename) {
+  for (size_t i = 0; i < args.size(); i++) {
+    const std::string &arg = args[i];
     if (arg == "-i")
-      filename = argv[++i];
+      filename = args.at(++i);
     else if (arg == "-t")
-      s = std::stod(argv[++i]);
+      par.s = std::stod(args.at(++i));
     else if (arg == "-p")
-      p = std::stoi(argv[++i]);
+      par.p = std::stoi(args.at(++i));
     else if (arg == "-pe")
-      pe = std::stod(argv[++i]);
+      par.pe = std::stod(args.at(++i));
     else if (arg == "-pm")
-      pm = std::stod(argv[++i]);
+      par.pm = std::stod(args.at(++i));
     else if (arg == "-rhoe")
-      rhoe = std::stod(argv[++i]);
+      par.rhoe = std::stod(args.at(++i));
     else if (arg == "-seed")
-      seed = std::stoul(argv[++i]);
+      par.seed = std::stoul(args.at(++i));
+    else if (arg == "-ls")
+      par.ls = std::stol(args.at(++i));
+    else if (arg == "-stag")
+      par.stag = std::stoi(args.at(++i));
+    else if (arg == "-div")
+      par.div = std::stod(args.at(++i));
+    else if (arg == "-warm")
+      par.warm = std::stod(args.at(++i));
+    else if (arg == "-trace")
+      par.trace = args.at(++i);
+    else if (arg == "-kernel")
+      par.kernel = std::stoi(args.at(++i));
+    else if (arg == "-dense")
+      par.dense = std::stod(args.at(++i));
     else {
       std::cerr << "Argumento desconocido: " << arg << "\n";
-      return 1;
+      return false;
+    }
+  }
+  return true;
+}
+
+// resuelve el grafo ya cargado y devuelve el tamaño del conjunto
+// independiente encontrado
+int resolver(int V, std::vector<std::vector<int>> adj, const Parametros &par) {
+  // densidad de la instancia (antes del kernel): decide el motor
+  double densidad = MaxClique::density(V, adj);
+
+  // --- Kernel opcional: el BRKGA trabaja sobre el grafo reducido ---
+  std::unique_ptr<Kernel> K;
+  if (par.kernel) {
+    K.reset(new Kernel(V, adj));
+    std::cerr << "# kernel n=" << V << " k=" << K->size()
+              << " m=" << K->edges() << " fijos=" << K->offset()
+              << " t=" << K->seconds() << "\n";
+    if (K->size() == 0) {
+      // las reducciones resolvieron el grafo completo
+      return K->offset();
     }
+    adj = K->graph();
+    V = K->size();
   }
 
+  std::vector<int> independentSet;
+  if (par.dense > 0 && densidad >= par.dense) {
+    // --- Grafo denso: el MIS es chico y el complemento ralo, se resuelve
+    // exacto como clique maxima del complemento partiendo de reducing-peeling
+    // (la traza registra la solucion inicial y cada mejora de la busqueda en
+    // el momento en que ocurren)
+    Trace traza;
+    traza.iniciar(std::chrono::steady_clock::now());
+    std::vector<int> inicial = reducingPeeling(V, adj);
+    traza.registrar(MEJORA, 0, 0, inicial.size());
+    MaxClique mc(V, adj);
+    mc.onImprove([&](int tam) { traza.registrar(MEJORA, 0, 0, tam); });
+    independentSet = mc.solve(inicial, par.s);
+    traza.registrar(FIN, 0, 0, independentSet.size());
+    std::cerr << "# denso d=" << densidad
+              << " ub=" << mc.bound() + (K ? K->offset() : 0)
+              << " optimo=" << mc.optimal() << " nodos=" << mc.nodes()
+              << " t=" << traza.segundos() << "\n";
+    if (!par.trace.empty())
+      traza.volcar(par.trace, K ? K->offset() : 0);
+  } else {
+    // --- BRKGA Algorithm ---
+    BRKGA brkga(V, par.p, par.pe, par.pm, par.rhoe, par.s, adj, par.seed);
+    brkga.setLocalSearch(par.ls);
+    brkga.setStagnation(par.stag, par.div);
+    brkga.setWarmStart(par.warm);
+
+    // cota superior sobre el grafo (o kernel) que resuelve el BRKGA
+    UpperBound cota(V, adj);
+    std::cerr << "# cota ub=" << cota.value() + (K ? K->offset() : 0)
+              << " t=" << cota.seconds() << "\n";
+    brkga.setUpperBound(cota.value());
+    independentSet = brkga.getSolution();
+    if (!par.trace.empty())
+      brkga.getTrace().volcar(par.trace, K ? K->offset() : 0);
+  }
+  if (K)
+    independentSet = K->lift(independentSet);
+  return independentSet.size();
+}
+
+int main(int argc, char *argv[]) {
+
+  // --- Modo batch: todos los trabajos del manifiesto en este proceso, cada
+  // grafo se lee una sola vez (ver utils/Batch.h). La semilla de cada
+  // trabajo reemplaza a -seed
+  if (argc >= 2 && std::string(argv[1]) == "-batch") {
+    return Batch::main(argc, argv, 1,
+                       [](int V, const std::vector<std::vector<int>> &adj,
+                          const BatchJob &job, int &value) {
+                         Parametros par;
+                         std::string ignorado;
+                         if (!leerParametros(job.params, par, ignorado) ||
+                             par.s <= 0 || par.p <= 0)
+                           return false;
+                         par.seed = job.seed;
+                         value = resolver(V, adj, par);
+                         return true;
+                       });
+  }
+
+  // Graph reading:
+  if (argc < 15) {
+    std::cerr << "Uso: ./brkga -i <instancia.txt> -t <tiempoSegundos> "
+                 "-p <poblacion> -pe <elite> -pm <mutantes> -rhoe <herencia> "
+                 "-seed <semilla> [-ls <presupuesto>] "
+                 "[-stag <generaciones>] [-div <diversidad>] [-warm <fraccion>] "
+                 "[-trace <archivo>] [-dense <densidad>] [-kernel <0|1>]\n"
+                 "       ./brkga -batch <manifiesto> [-o <salida.csv>]\n";
+    return 1;
+  }
+
+  std::string filename;
+  Parametros par;
+  if (!leerParametros({argv + 1, argv + argc}, par, filename))
+    return 1;
+
   int V;
   std::vector<std::vector<int>> adj;
 
@@ -55,16 +183,8 @@ int main(int argc, char *argv[]) {
     return 1;
   }
 
-  // --- BRKGA Algorithm ---
-  BRKGA brkga(V, p, pe, pm, rhoe, s, adj, seed);
-  std::vector<int> independentSet = brkga.getSolution();
-
-  // for (int i = 0; i < independentSet.size(); i++) {
-  //   std::cout << independentSet[i] << " ";
-  // }
-  // std::cout << "\n";
-
-  std::cout << independentSet.size() << "\n";
+  int tam = resolver(V, std::move(adj), par);
+  std::cout << tam << "\n";
 
   return 0;
 }
@@ -1,6 +1,9 @@
 #include "brkga_class.h"
+#include "utils/FixedBitset.h"
+#include "utils/ReducingPeeling.h"
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <iostream>
 #include <random>
 
@@ -13,6 +16,23 @@ BRKGA::BRKGA(int n, int p, double pe, double pm, double rhoe, double s,
     : n(n), p(p), pe(pe), pm(pm), rhoe(rhoe), s(s), poblacion(p),
       nueva_poblacion(p), adj(adj), rng(seed) {
   best_global_fitness = 0;
+  ls_budget = 0;
+  num_generaciones = 0;
+  gens_sin_mejora = 0;
+  stag_gens = 0;
+  min_div = 0.05;
+  warm_frac = 0.0;
+  cota_superior = n;
+
+  palabras = (n + 64) / 64;
+  if (n <= 4096) {
+    filas.assign((size_t)(n + 1) * palabras, 0);
+    for (int v = 1; v <= n; v++)
+      for (int u : adj[v])
+        bits::set(&filas[(size_t)v * palabras], u);
+  }
+  num_decodificaciones = 0;
+  start_time = std::chrono::steady_clock::now();
 }
 
 BRKGA::~BRKGA() {}
@@ -22,10 +42,27 @@ Inicializamos la población generando p individuos con cromosomas aleatorios.
 Cada gen del cromosoma se genera de manera uniforme en el rango [0,1].
 Definimos el fitness de cada individuo como -1 inicialmente, indicando que aún
 no ha sido evaluado.
+Si warm_frac > 0, los primeros warm_frac * p individuos se siembran con
+soluciones heuristicas: el primero con reducing-peeling y el resto
+alternando greedy aleatorizado y SA corto sobre un greedy aleatorizado.
 */
 void BRKGA::inicializar_poblacion() {
+  const int k_rcl = 10; // tamaño de la RCL del greedy aleatorizado
+  int nSemillas = std::min(p, (int)(p * warm_frac));
+  for (int i = 0; i < nSemillas; i++) {
+    std::vector<int> sol;
+    if (i == 0)
+      sol = reducingPeeling(n, adj);
+    else if (i % 2 == 1)
+      sol = greedyRand(k_rcl);
+    else
+      sol = saCorto(greedyRand(k_rcl), n);
+    poblacion[i] = codificar(sol);
+    evaluar(poblacion[i]);
+  }
+
   std::uniform_real_distribution<double> dist(0.0, 1.0);
-  for (int i = 0; i < p; i++) {
+  for (int i = nSemillas; i < p; i++) {
     Individuo individuo;
     cromosoma cr(n);
     for (int j = 0; j < n; j++) {
@@ -33,7 +70,7 @@ void BRKGA::inicializar_poblacion() {
       cr[j].second = j + 1;
     }
     individuo.cr = cr;
-    individuo.fitness = getFitness(decoder(individuo));
+    evaluar(individuo);
 
     poblacion[i] = individuo;
   }
@@ -43,22 +80,28 @@ void BRKGA::inicializar_poblacion() {
   best_global = poblacion[0];
   best_global_fitness = getFitness(decoder(best_global));
 
-  // Imprime el primer log "Any-Time"
-  auto now = std::chrono::high_resolution_clock::now();
-  double elapsed_s = std::chrono::duration<double>(now - start_time).count();
-
-  // std::cerr << best_global_fitness << " " << elapsed_s << "\n";
+  // Registra el primer evento "Any-Time"
+  traza.registrar(MEJORA, num_generaciones, num_decodificaciones,
+                  best_global_fitness);
 }
 
 std::vector<int> BRKGA::decoder(Individuo ind) {
-  std::vector<int> independentSet;
-  std::vector<bool> marked(n + 1, 0);
+  num_decodificaciones++;
 
   // ordenar individuo segun su cromosoma.first de mayor a menor
   std::sort(ind.cr.begin(), ind.cr.end(),
             [](const std::pair<double, int> &a,
                const std::pair<double, int> &b) { return a.first > b.first; });
 
+  if (!filas.empty())
+    return bits::dispatchWidth(palabras, [&](auto w) {
+      return seleccionar<decltype(w)::value>(ind.cr);
+    });
+
+  // (solo el camino sin filas de bits usa la marca por nodo)
+  std::vector<int> independentSet;
+  std::vector<bool> marked(n + 1, 0);
+
   // enfoque greddy, se toma el primer vertice al siguiente
   for (const auto &par : ind.cr) {
     int node = par.second;
@@ -75,8 +118,332 @@ std::vector<int> BRKGA::decoder(Individuo ind) {
   return independentSet;
 }
 
+// mismo greedy del decoder sobre filas de bits, con el ancho fijado en
+// compilacion para n = 1000/2000/3000 (utils/FixedBitset.h)
+template <int WORDS>
+std::vector<int> BRKGA::seleccionar(const cromosoma &cr) const {
+  std::vector<int> independentSet;
+  std::vector<uint64_t> marked(palabras, 0);
+  for (const auto &par : cr) {
+    int node = par.second;
+    if (node == 0 || bits::test(marked.data(), node))
+      continue;
+    independentSet.push_back(node);
+    bits::set(marked.data(), node);
+    bits::orInto<WORDS>(marked.data(), &filas[(size_t)node * palabras],
+                        palabras);
+  }
+  return independentSet;
+}
+
 int BRKGA::getFitness(std::vector<int> decodified) { return decodified.size(); }
 
+void BRKGA::setLocalSearch(long budget) { ls_budget = budget; }
+
+void BRKGA::setWarmStart(double frac) { warm_frac = frac; }
+
+void BRKGA::setUpperBound(int cota) { cota_superior = cota; }
+
+/*
+Codifica una solucion con el mismo esquema que super_ind en BARRAKUDA: los
+nodos de la solucion reciben llaves altas (0.9 + ruido) y el resto llaves
+bajas (0.1 + ruido), asi el decoder los elige primero.
+*/
+Individuo BRKGA::codificar(const std::vector<int> &sol) {
+  Individuo ind;
+  ind.cr.resize(n);
+
+  std::vector<char> elegido(n + 1, 0);
+  for (int v : sol)
+    elegido[v] = 1;
+
+  std::uniform_real_distribution<double> noise(0.0, 0.1);
+  for (int i = 0; i < n; ++i) {
+    int nodo_id = i + 1;
+    ind.cr[i].second = nodo_id;
+    if (elegido[nodo_id])
+      ind.cr[i].first = 0.9 + noise(rng);
+    else
+      ind.cr[i].first = 0.1 + noise(rng);
+  }
+  return ind;
+}
+
+// greedy aleatorizado: se elige al azar entre los k nodos libres de menor
+// grado (RCL, igual que greedyRand)
+std::vector<int> BRKGA::greedyRand(int k) {
+  std::vector<std::pair<int, int>> grados(n);
+  for (int v = 1; v <= n; v++)
+    grados[v - 1] = {adj[v].size(), v};
+  std::sort(grados.begin(), grados.end());
+
+  std::vector<int> independentSet;
+  std::vector<bool> marked(n + 1, 0);
+  std::vector<int> rcl;
+  size_t inicio = 0; // primer nodo libre en el orden por grado
+  while (true) {
+    while (inicio < grados.size() && marked[grados[inicio].second])
+      inicio++;
+    rcl.clear();
+    for (size_t i = inicio; i < grados.size() && (int)rcl.size() < k; i++)
+      if (!marked[grados[i].second])
+        rcl.push_back(grados[i].second);
+    if (rcl.empty())
+      break;
+
+    std::uniform_int_distribution<int> elegir(0, rcl.size() - 1);
+    int node = rcl[elegir(rng)];
+    independentSet.push_back(node);
+    marked[node] = true;
+    for (const auto &neighbor : adj[node])
+      marked[neighbor] = true;
+  }
+  return independentSet;
+}
+
+/*
+Simulated annealing corto a partir de una solucion: se elige un nodo v fuera
+de la solucion y se inserta sacando sus vecinos en la solucion. El cambio de
+tamaño es 1 - (vecinos en la solucion); los empeoramientos se aceptan con
+probabilidad exp(delta / T). La temperatura baja de 1 a 0.01 en iters pasos.
+*/
+std::vector<int> BRKGA::saCorto(const std::vector<int> &inicial, int iters) {
+  std::vector<char> inSol(n + 1, 0);
+  std::vector<int> tight(n + 1, 0);
+  for (int v : inicial) {
+    inSol[v] = 1;
+    for (int u : adj[v])
+      tight[u]++;
+  }
+
+  std::vector<int> mejor = inicial;
+  int actual = inicial.size();
+  double T = 1.0;
+  double alpha = std::pow(0.01, 1.0 / std::max(1, iters));
+  std::uniform_int_distribution<int> nodo(1, n);
+  std::uniform_real_distribution<double> dist(0.0, 1.0);
+
+  for (int it = 0; it < iters; it++, T *= alpha) {
+    int v = nodo(rng);
+    if (inSol[v])
+      continue;
+    int delta = 1 - tight[v];
+    if (delta < 0 && dist(rng) >= std::exp(delta / T))
+      continue;
+
+    for (int u : adj[v]) {
+      if (inSol[u]) {
+        inSol[u] = 0;
+        for (int w : adj[u])
+          tight[w]--;
+      }
+    }
+    inSol[v] = 1;
+    for (int u : adj[v])
+      tight[u]++;
+    actual += delta;
+
+    if (actual > (int)mejor.size()) {
+      mejor.clear();
+      for (int u = 1; u <= n; u++)
+        if (inSol[u])
+          mejor.push_back(u);
+    }
+  }
+  return mejor;
+}
+
+void BRKGA::setStagnation(int gens, double div) {
+  stag_gens = gens;
+  min_div = div;
+}
+
+/*
+Diversidad de la poblacion: promedio, sobre todos los genes, de la desviacion
+estandar de las llaves de ese gen entre los primeros m individuos (la poblacion
+debe estar ordenada). Se mide sobre la elite porque los mutantes son siempre
+aleatorios. Llaves uniformes dan ~0.29; una elite convergida tiende a 0.
+*/
+double BRKGA::diversidad(int m) {
+  std::vector<double> suma(n, 0.0), suma2(n, 0.0);
+  for (int i = 0; i < m; i++) {
+    for (int j = 0; j < n; j++) {
+      double k = poblacion[i].cr[j].first;
+      suma[j] += k;
+      suma2[j] += k * k;
+    }
+  }
+  double total = 0.0;
+  for (int j = 0; j < n; j++) {
+    double media = suma[j] / m;
+    total += std::sqrt(std::max(0.0, suma2[j] / m - media * media));
+  }
+  return total / n;
+}
+
+/*
+Si el mejor global no mejora en stag_gens generaciones se actua sobre los
+individuos no elite (la elite se conserva):
+ - diversidad < min_div: reinicio parcial, llaves nuevas uniformes.
+ - en otro caso: shaking, cada llave se re-sortea con probabilidad 0.1.
+Cada evento se informa por stderr con el tiempo transcurrido.
+*/
+void BRKGA::controlarEstancamiento() {
+  if (stag_gens <= 0 || gens_sin_mejora < stag_gens)
+    return;
+
+  int nElite = p * pe;
+  std::sort(poblacion.begin(), poblacion.end());
+
+  double div = diversidad(std::max(2, nElite));
+  bool reinicio = div < min_div;
+
+  std::uniform_real_distribution<double> dist(0.0, 1.0);
+  for (int i = nElite; i < p; i++) {
+    for (int j = 0; j < n; j++) {
+      if (reinicio || dist(rng) < 0.1)
+        poblacion[i].cr[j].first = dist(rng);
+    }
+    evaluar(poblacion[i]);
+  }
+  std::sort(poblacion.begin(), poblacion.end());
+
+  if (poblacion[0].fitness > best_global_fitness) {
+    best_global_fitness = poblacion[0].fitness;
+    best_global = poblacion[0];
+    traza.registrar(MEJORA, num_generaciones, num_decodificaciones,
+                    best_global_fitness);
+  }
+  gens_sin_mejora = 0;
+
+  traza.registrar(reinicio ? REINICIO : SHAKING, num_generaciones,
+                  num_decodificaciones, best_global_fitness);
+  std::cerr << "# " << (reinicio ? "reinicio" : "shaking")
+            << " gen=" << num_generaciones << " t=" << traza.segundos()
+            << " div=" << div << " mejor=" << best_global_fitness << "\n";
+}
+
+void BRKGA::evaluar(Individuo &ind) {
+  std::vector<int> sol = decoder(ind);
+  if (ls_budget > 0) {
+    size_t antes = sol.size();
+    sol = busquedaLocal(sol);
+    if (sol.size() > antes)
+      recodificar(ind, sol);
+  }
+  ind.fitness = getFitness(sol);
+}
+
+/*
+Busqueda local (1,2)-swap: para cada nodo x de la solucion se buscan dos
+vecinos u, w de x que no sean adyacentes entre si y cuyo unico vecino en la
+solucion sea x (tight = 1). Sacar x y agregar u, w aumenta la solucion en uno.
+Despues de cada movimiento se agregan los vecinos de x que quedaron libres
+(tight = 0) para que la solucion siga siendo maximal.
+El costo se mide en entradas de adyacencia revisadas y se corta al llegar a
+ls_budget.
+*/
+std::vector<int> BRKGA::busquedaLocal(const std::vector<int> &sol) {
+  std::vector<char> inSol(n + 1, 0);
+  std::vector<int> tight(n + 1, 0); // vecinos de cada nodo en la solucion
+  std::vector<int> marca(n + 1, 0);
+  int sello = 0;
+  long trabajo = 0;
+
+  auto insertar = [&](int v) {
+    inSol[v] = 1;
+    for (int u : adj[v])
+      tight[u]++;
+    trabajo += adj[v].size();
+  };
+
+  std::vector<int> pendientes(sol.begin(), sol.end());
+  for (int v : sol)
+    insertar(v);
+
+  std::vector<int> libres; // candidatos con tight = 1 alrededor de x
+  for (size_t idx = 0; idx < pendientes.size() && trabajo < ls_budget; idx++) {
+    int x = pendientes[idx];
+    if (!inSol[x])
+      continue;
+
+    libres.clear();
+    for (int v : adj[x])
+      if (v != 0 && !inSol[v] && tight[v] == 1)
+        libres.push_back(v);
+    trabajo += adj[x].size();
+    if (libres.size() < 2)
+      continue;
+
+    // buscamos un par (u, w) de candidatos no adyacentes
+    int u = -1, w = -1;
+    for (size_t a = 0; a + 1 < libres.size() && u == -1; a++) {
+      sello++;
+      for (int v : adj[libres[a]])
+        marca[v] = sello;
+      trabajo += adj[libres[a]].size();
+      for (size_t b = a + 1; b < libres.size(); b++) {
+        if (marca[libres[b]] != sello) {
+          u = libres[a];
+          w = libres[b];
+          break;
+        }
+      }
+      if (trabajo >= ls_budget)
+        break;
+    }
+    if (u == -1)
+      continue;
+
+    // aplicamos el movimiento: sale x, entran u y w
+    inSol[x] = 0;
+    for (int v : adj[x])
+      tight[v]--;
+    insertar(u);
+    insertar(w);
+    pendientes.push_back(u);
+    pendientes.push_back(w);
+
+    // completamos con los vecinos de x que quedaron libres
+    for (int v : adj[x]) {
+      if (v != 0 && !inSol[v] && tight[v] == 0) {
+        insertar(v);
+        pendientes.push_back(v);
+      }
+    }
+  }
+
+  std::vector<int> mejorada;
+  for (int v = 1; v <= n; v++)
+    if (inSol[v])
+      mejorada.push_back(v);
+  return mejorada;
+}
+
+/*
+Recodificacion lamarckiana: igual que super_ind en runBarrakuda, los nodos de
+la solucion deben quedar con llaves mas altas que el resto. Solo se suben las
+llaves de los nodos elegidos que estan por debajo de la mayor llave de un nodo
+no elegido; las demas llaves no se tocan. Como la solucion es maximal, el
+decoder vuelve a producir exactamente la misma solucion.
+*/
+void BRKGA::recodificar(Individuo &ind, const std::vector<int> &sol) {
+  std::vector<char> elegido(n + 1, 0);
+  for (int v : sol)
+    elegido[v] = 1;
+
+  double umbral = 0.0;
+  for (int j = 0; j < n; j++)
+    if (!elegido[ind.cr[j].second])
+      umbral = std::max(umbral, ind.cr[j].first);
+
+  std::uniform_real_distribution<double> dist(0.5, 1.0);
+  for (int j = 0; j < n; j++) {
+    if (elegido[ind.cr[j].second] && ind.cr[j].first <= umbral)
+      ind.cr[j].first = umbral + (1.0 - umbral) * dist(rng);
+  }
+}
+
 void BRKGA::generacion() {
   /*
     nElite = número de individuos elite
@@ -90,16 +457,18 @@ void BRKGA::generacion() {
   // Ordenamos la población por fitness para poder seleccionar a los elite.
   std::sort(poblacion.begin(), poblacion.end());
 
+  num_generaciones++;
+
   // Any-Time
+  gens_sin_mejora++;
   if (poblacion[0].fitness > best_global_fitness) {
     best_global_fitness = poblacion[0].fitness;
     best_global = poblacion[0];
+    gens_sin_mejora = 0;
 
-    // Imprime el log "Any-Time"
-    auto now = std::chrono::high_resolution_clock::now();
-    double elapsed_s = std::chrono::duration<double>(now - start_time).count();
-
-    // std::cerr << best_global_fitness << " " << elapsed_s << "\n";
+    // Registra el evento "Any-Time"
+    traza.registrar(MEJORA, num_generaciones, num_decodificaciones,
+                    best_global_fitness);
   }
 
   for (int i = 0; i < nElite; i++) {
@@ -117,7 +486,7 @@ void BRKGA::generacion() {
       cr[j].second = j + 1;
     }
     individuo.cr = cr;
-    individuo.fitness = getFitness(decoder(individuo));
+    evaluar(individuo);
 
     nueva_poblacion[nElite + i] = individuo;
   }
@@ -151,20 +520,29 @@ void BRKGA::generacion() {
       }
     }
     /*ahora toca evaluar al hijo*/
-    hijo.fitness = getFitness(decoder(hijo));
+    evaluar(hijo);
     nueva_poblacion[nElite + nMutante + i] = hijo;
   }
   poblacion = nueva_poblacion;
 }
 
 std::vector<int> BRKGA::getSolution() {
-  auto start = std::chrono::high_resolution_clock::now();
+  auto start = std::chrono::steady_clock::now();
   auto end = start + std::chrono::seconds(static_cast<int>(s));
+  start_time = start;
+  traza.iniciar(start);
 
   inicializar_poblacion();
-  while (std::chrono::high_resolution_clock::now() < end) {
+  // se corta antes si el mejor global ya es optimo demostrado
+  while (std::chrono::steady_clock::now() < end &&
+         best_global_fitness < cota_superior) {
     generacion();
+    controlarEstancamiento();
   }
 
+  traza.registrar(FIN, num_generaciones, num_decodificaciones,
+                  best_global_fitness);
   return decoder(best_global);
-}
\ No newline at end of file
+}
+
+const Trace &BRKGA::getTrace() const { return traza; }
@@ -2,9 +2,11 @@
 #define BRKGA_CLASS_H
 
 #include <chrono>
+#include <cstdint>
 #include <random>
 #include <utility>
 #include <vector>
+#include "utils/Trace.h"
 
 // tipo de cromosoma: vector de pares (valor double usado para orden/ranking, id
 // entero)
@@ -45,6 +47,26 @@ public:
   // calcula el fitness de una solucion decodifiacada
   int getFitness(std::vector<int> decodified);
 
+  // decodifica y evalua un individuo. Si la busqueda local esta activa, la
+  // solucion mejorada se escribe de vuelta en el cromosoma (lamarckiano)
+  void evaluar(Individuo &ind);
+
+  // activa la busqueda local (1,2)-swap en el decoder. budget: cantidad maxima
+  // de entradas de adyacencia revisadas por decodificacion (0 = desactivada)
+  void setLocalSearch(long budget);
+
+  // activa el control de estancamiento. gens: generaciones sin mejora antes de
+  // actuar (0 = desactivado); div: diversidad minima antes de reiniciar
+  void setStagnation(int gens, double div);
+
+  // siembra una fraccion frac de la poblacion inicial con soluciones de
+  // reducing-peeling, greedy aleatorizado y SA corto (0 = desactivado)
+  void setWarmStart(double frac);
+
+  // cota superior del optimo: getSolution termina antes del tiempo limite si
+  // el mejor global la alcanza
+  void setUpperBound(int cota);
+
   // ejecuta la generacion: crea una nueva poblacion aplicando elite,
   // cruzamiento y mutacion
   void generacion(); // definimos elite, mutados y normales
@@ -52,6 +74,9 @@ public:
   // devuelve la mejor solucion encontrada (decodificada)
   std::vector<int> getSolution();
 
+  // traza any-time de la ultima ejecucion de getSolution
+  const Trace &getTrace() const;
+
 private:
   int n;       // tamaño del problema
   int p;       // tamaño de la poblacion
@@ -64,9 +89,39 @@ private:
   std::vector<Individuo> nueva_poblacion; // vector para la siguiente generacion
   std::vector<std::vector<int>> adj;      // grafo (matriz de adyacencia)
   std::mt19937 rng;
+  // adyacencia como filas de bits (vacio si n > 4096): el decoder marca los
+  // vecinos con un OR de palabras en vez de recorrer la lista
+  int palabras;
+  std::vector<uint64_t> filas;
+  template <int WORDS> std::vector<int> seleccionar(const cromosoma &cr) const;
   Individuo best_global;
   int best_global_fitness;
-  std::chrono::high_resolution_clock::time_point start_time;
+  std::chrono::steady_clock::time_point start_time;
+  Trace traza;               // eventos any-time (mejoras, reinicios, ...)
+  long num_decodificaciones; // llamadas al decoder
+  long ls_budget; // presupuesto de la busqueda local por decodificacion
+
+  // mejora una solucion maximal con movimientos (1,2)-swap
+  std::vector<int> busquedaLocal(const std::vector<int> &sol);
+  // sube las llaves de los nodos de sol para que el decoder la reproduzca
+  void recodificar(Individuo &ind, const std::vector<int> &sol);
+
+  int num_generaciones;  // generaciones ejecutadas
+  int gens_sin_mejora;   // generaciones desde la ultima mejora del mejor global
+  int stag_gens;         // umbral de estancamiento (0 = desactivado)
+  double min_div;        // diversidad bajo la cual se reinicia en vez de sacudir
+  // desviacion estandar promedio de las llaves de los m mejores individuos
+  double diversidad(int m);
+  // reinicio parcial o shaking de los no elite si la busqueda se estanco
+  void controlarEstancamiento();
+
+  double warm_frac; // fraccion de la poblacion inicial sembrada
+  int cota_superior; // el mejor global no puede superarla
+  // codifica una solucion con llaves altas para sus nodos (como super_ind)
+  Individuo codificar(const std::vector<int> &sol);
+  // heuristicas constructivas usadas para sembrar la poblacion
+  std::vector<int> greedyRand(int k);
+  std::vector<int> saCorto(const std::vector<int> &inicial, int iters);
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,428 @@
+/*
+Runner de experimentos del BRKGA (reemplaza a scripts/run_optimized_server.py)
+
+Ejecuta el binario brkga sobre tamaños x densidades x instancias del dataset
+repartiendo las corridas entre N hilos trabajadores. Cada hilo queda fijado
+a una CPU distinta del conjunto permitido al proceso (respeta taskset/slurm)
+y lanza sus corridas desde ahi: el hijo hereda la afinidad, asi dos corridas
+simultaneas no comparten nucleo y sus tiempos no se distorsionan.
+
+Salida, con el mismo formato que el script:
+  <out>/results<n>_brkga_optimized.csv          DENSITY,INSTANCE,VALOR
+  <out>/results<n>_brkga_optimized_summary.csv  DENSITY,MEDIA_CALIDAD,STD_CALIDAD
+Cada resultado se agrega al CSV apenas termina la corrida. Al reiniciar se
+leen los CSV existentes y se omiten las corridas ya registradas (una linea
+cortada por una interrupcion se descarta). Al final los CSV se reescriben
+ordenados y se regenera el resumen por densidad.
+
+Uso:
+  ./runner [-bin <brkga>] [-dataset <dir>] [-out <dir>] [-workers <N>]
+           [-sizes 1000,2000,3000] [-densities 0.1,...,0.9] [-instances 30]
+           [-t 10] [-p 264] [-pe 0.14] [-pm 0.25] [-rhoe 0.65] [-seed 42]
+           [-dense 0]
+
+-dense se reenvia a brkga. Por defecto 0: las densidades altas tambien se
+resuelven con el BRKGA y no con la clique maxima, asi los CSV se pueden
+comparar con los anteriores.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <csignal>
+#include <fcntl.h>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <poll.h>
+#include <sched.h>
+#include <spawn.h>
+#include <sstream>
+#include <string>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+extern char **environ;
+
+namespace {
+
+struct Configuracion {
+  std::string bin = "./brkga";
+  std::string dataset = "../../dataset_grafos_no_dirigidos";
+  std::string out = "../testing";
+  int workers = 0; // 0 = una por CPU permitida
+  std::vector<std::string> sizes = {"1000", "2000", "3000"};
+  std::vector<std::string> densities = {"0.1", "0.2", "0.3", "0.4", "0.5",
+                                        "0.6", "0.7", "0.8", "0.9"};
+  int instances = 30;
+  // parametros optimizados por tuning
+  std::string t = "10", p = "264", pe = "0.14", pm = "0.25", rhoe = "0.65",
+              seed = "42";
+  std::string dense = "0"; // 0 = siempre el BRKGA (ver -dense de brkga)
+};
+
+struct Corrida {
+  std::string size, density;
+  int instance;
+  std::string archivo;
+};
+
+// resultados por tamaño: (densidad, instancia) -> valor
+using Resultados = std::map<std::pair<std::string, int>, int>;
+
+std::vector<std::string> separar(const std::string &lista) {
+  std::vector<std::string> partes;
+  std::stringstream ss(lista);
+  for (std::string x; std::getline(ss, x, ',');)
+    if (!x.empty())
+      partes.push_back(x);
+  return partes;
+}
+
+std::string archivoResultados(const Configuracion &cfg,
+                              const std::string &size) {
+  return cfg.out + "/results" + size + "_brkga_optimized.csv";
+}
+
+// CPUs en las que el proceso puede correr
+std::vector<int> cpusPermitidas() {
+  std::vector<int> cpus;
+#ifdef __linux__
+  cpu_set_t mask;
+  if (sched_getaffinity(0, sizeof(mask), &mask) == 0)
+    for (int c = 0; c < CPU_SETSIZE; ++c)
+      if (CPU_ISSET(c, &mask))
+        cpus.push_back(c);
+#endif
+  if (cpus.empty())
+    cpus.push_back(-1); // sin afinidad
+  return cpus;
+}
+
+// fija el hilo que llama a la CPU cpu (-1 = no hace nada)
+void fijarHilo(int cpu) {
+#ifdef __linux__
+  if (cpu < 0)
+    return;
+  cpu_set_t mask;
+  CPU_ZERO(&mask);
+  CPU_SET(cpu, &mask);
+  sched_setaffinity(0, sizeof(mask), &mask); // 0 = hilo actual
+#else
+  (void)cpu;
+#endif
+}
+
+/*
+Lee un CSV de resultados previo. Se aceptan todas las lineas completas, aun
+las de densidades fuera de -densities (se conservan al reescribir); el
+archivo se reescribe con esas lineas para que las nuevas se agreguen a
+continuacion de un final limpio.
+*/
+Resultados reanudar(const Configuracion &cfg, const std::string &size) {
+  Resultados hechos;
+  std::string nombre = archivoResultados(cfg, size);
+  std::ifstream in(nombre);
+  std::string linea;
+  bool cabecera = true;
+  while (in && std::getline(in, linea)) {
+    if (cabecera) {
+      cabecera = false;
+      continue;
+    }
+    if (in.eof())
+      break; // sin salto de linea final: corrida interrumpida al escribir
+    auto campos = separar(linea);
+    if (campos.size() != 3)
+      continue;
+    int instancia, valor;
+    auto r1 = std::from_chars(campos[1].data(),
+                              campos[1].data() + campos[1].size(), instancia);
+    auto r2 = std::from_chars(campos[2].data(),
+                              campos[2].data() + campos[2].size(), valor);
+    if (r1.ec != std::errc() || r2.ec != std::errc() ||
+        r2.ptr != campos[2].data() + campos[2].size())
+      continue;
+    hechos[{campos[0], instancia}] = valor;
+  }
+  return hechos;
+}
+
+bool enConfiguracion(const Configuracion &cfg, const std::string &d) {
+  return std::find(cfg.densities.begin(), cfg.densities.end(), d) !=
+         cfg.densities.end();
+}
+
+// reescribe el CSV de resultados con las filas en el orden del script; las
+// de densidades fuera de -densities (de otra ejecucion) van al final
+void escribirResultados(const Configuracion &cfg, const std::string &size,
+                        const Resultados &filas) {
+  std::ofstream out(archivoResultados(cfg, size));
+  out << "DENSITY,INSTANCE,VALOR\n";
+  for (const auto &d : cfg.densities)
+    for (const auto &f : filas)
+      if (f.first.first == d)
+        out << d << "," << f.first.second << "," << f.second << "\n";
+  for (const auto &f : filas)
+    if (!enConfiguracion(cfg, f.first.first))
+      out << f.first.first << "," << f.first.second << "," << f.second
+          << "\n";
+}
+
+// numero como lo imprime Python: repr mas corto; flotante agrega ".0" a los
+// enteros (statistics.mean devuelve int si la media es exacta, stdev no)
+std::string formatoPython(double x, bool flotante) {
+  char buf[64];
+  auto r = std::to_chars(buf, buf + sizeof(buf), x);
+  std::string s(buf, r.ptr);
+  if (flotante && s.find_first_of(".e") == std::string::npos)
+    s += ".0";
+  return s;
+}
+
+void escribirResumen(const Configuracion &cfg, const std::string &size,
+                     const Resultados &filas) {
+  std::string nombre = archivoResultados(cfg, size);
+  nombre.replace(nombre.size() - 4, 4, "_summary.csv");
+  std::ofstream out(nombre);
+  out << "DENSITY,MEDIA_CALIDAD,STD_CALIDAD\n";
+  std::cout << "\n  RESUMEN TAMAÑO " << size << ":\n";
+  for (const auto &d : cfg.densities) {
+    std::vector<int> vals;
+    for (const auto &f : filas)
+      if (f.first.first == d)
+        vals.push_back(f.second);
+    if (vals.empty())
+      continue;
+    long suma = 0;
+    for (int v : vals)
+      suma += v;
+    double media = (double)suma / vals.size();
+    bool media_entera = suma % (long)vals.size() == 0;
+    std::string desv = "0";
+    if (vals.size() > 1) {
+      double ss = 0;
+      for (int v : vals)
+        ss += (v - media) * (v - media);
+      desv = formatoPython(std::sqrt(ss / (vals.size() - 1)), true);
+    }
+    out << d << "," << formatoPython(media, !media_entera) << "," << desv
+        << "\n";
+    std::cout << "  d=" << d << " media=" << media << " desv=" << desv
+              << " n=" << vals.size() << "\n";
+  }
+}
+
+/*
+Lanza el brkga con la afinidad del hilo actual y devuelve su primera linea
+de stdout. La corrida se mata si supera limite segundos.
+*/
+bool ejecutar(const std::vector<std::string> &args, double limite,
+              std::string &salida) {
+  int tubo[2];
+  if (pipe2(tubo, O_CLOEXEC) != 0)
+    return false;
+  posix_spawn_file_actions_t acciones;
+  posix_spawn_file_actions_init(&acciones);
+  posix_spawn_file_actions_adddup2(&acciones, tubo[1], STDOUT_FILENO);
+  posix_spawn_file_actions_addopen(&acciones, STDERR_FILENO, "/dev/null",
+                                   O_WRONLY, 0);
+
+  std::vector<char *> argv;
+  for (const auto &a : args)
+    argv.push_back(const_cast<char *>(a.c_str()));
+  argv.push_back(nullptr);
+
+  pid_t pid;
+  int err = posix_spawn(&pid, argv[0], &acciones, nullptr, argv.data(),
+                        environ);
+  posix_spawn_file_actions_destroy(&acciones);
+  close(tubo[1]);
+  if (err != 0) {
+    close(tubo[0]);
+    return false;
+  }
+
+  auto fin = std::chrono::steady_clock::now() +
+             std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                 std::chrono::duration<double>(limite));
+  bool vencido = false;
+  char buf[4096];
+  while (true) {
+    auto resta = std::chrono::duration_cast<std::chrono::milliseconds>(
+                     fin - std::chrono::steady_clock::now())
+                     .count();
+    if (resta <= 0) {
+      vencido = true;
+      kill(pid, SIGKILL);
+      break;
+    }
+    pollfd pfd = {tubo[0], POLLIN, 0};
+    if (poll(&pfd, 1, (int)std::min<long>(resta, 1000)) <= 0)
+      continue;
+    ssize_t leidos = read(tubo[0], buf, sizeof(buf));
+    if (leidos <= 0)
+      break; // EOF: el hijo termino
+    salida.append(buf, leidos);
+  }
+  close(tubo[0]);
+  int estado;
+  waitpid(pid, &estado, 0);
+  if (vencido || !WIFEXITED(estado) || WEXITSTATUS(estado) != 0)
+    return false;
+  salida = salida.substr(0, salida.find('\n'));
+  return !salida.empty();
+}
+
+} // namespace
+
+int main(int argc, char *argv[]) {
+  Configuracion cfg;
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    if (i + 1 >= argc) {
+      std::cerr << "Falta el valor de " << arg << "\n";
+      return 1;
+    }
+    std::string valor = argv[++i];
+    if (arg == "-bin")
+      cfg.bin = valor;
+    else if (arg == "-dataset")
+      cfg.dataset = valor;
+    else if (arg == "-out")
+      cfg.out = valor;
+    else if (arg == "-workers")
+      cfg.workers = std::stoi(valor);
+    else if (arg == "-sizes")
+      cfg.sizes = separar(valor);
+    else if (arg == "-densities")
+      cfg.densities = separar(valor);
+    else if (arg == "-instances")
+      cfg.instances = std::stoi(valor);
+    else if (arg == "-t")
+      cfg.t = valor;
+    else if (arg == "-p")
+      cfg.p = valor;
+    else if (arg == "-pe")
+      cfg.pe = valor;
+    else if (arg == "-pm")
+      cfg.pm = valor;
+    else if (arg == "-rhoe")
+      cfg.rhoe = valor;
+    else if (arg == "-seed")
+      cfg.seed = valor;
+    else if (arg == "-dense")
+      cfg.dense = valor;
+    else {
+      std::cerr << "Argumento desconocido: " << arg << "\n";
+      return 1;
+    }
+  }
+
+  if (access(cfg.bin.c_str(), X_OK) != 0) {
+    std::cerr << "Ejecutable no encontrado: " << cfg.bin
+              << " (compilar con make)\n";
+    return 1;
+  }
+  mkdir(cfg.out.c_str(), 0755);
+
+  // --- Corridas pendientes (las ya registradas en los CSV se omiten) ---
+  std::map<std::string, Resultados> resultados;
+  std::map<std::string, std::ofstream> salidas;
+  std::vector<Corrida> pendientes;
+  int previas = 0;
+  for (const auto &size : cfg.sizes) {
+    Resultados &hechos = resultados[size] = reanudar(cfg, size);
+    for (const auto &f : hechos)
+      previas += enConfiguracion(cfg, f.first.first);
+    escribirResultados(cfg, size, hechos);
+    salidas[size].open(archivoResultados(cfg, size), std::ios::app);
+    for (const auto &d : cfg.densities)
+      for (int j = 1; j <= cfg.instances; ++j) {
+        if (hechos.count({d, j}))
+          continue;
+        std::string f = cfg.dataset + "/new_" + size + "_dataset/erdos_n" +
+                        size + "_p0c" + d + "_" + std::to_string(j) + ".graph";
+        if (access(f.c_str(), R_OK) != 0) {
+          std::cout << "  " << f << " no encontrado\n";
+          continue;
+        }
+        pendientes.push_back({size, d, j, f});
+      }
+  }
+
+  std::vector<int> cpus = cpusPermitidas();
+  int workers = cfg.workers > 0 ? cfg.workers : (int)cpus.size();
+  if (workers > (int)cpus.size() && cpus.front() >= 0)
+    std::cerr << "Aviso: " << workers << " trabajadores para " << cpus.size()
+              << " CPUs, algunas corridas compartiran nucleo\n";
+  std::cout << "Corridas: " << pendientes.size() << " pendientes, " << previas
+            << " ya registradas; " << workers << " trabajadores\n";
+
+  // --- Trabajadores: cada uno fijado a su CPU toma la siguiente corrida ---
+  double limite = std::stod(cfg.t) + 15;
+  std::atomic<size_t> siguiente{0};
+  std::atomic<int> terminadas{0};
+  std::mutex mtx; // salidas, resultados y stdout
+  auto inicio = std::chrono::steady_clock::now();
+
+  auto trabajador = [&](int w) {
+    int cpu = cpus[w % cpus.size()];
+    fijarHilo(cpu);
+    for (size_t k; (k = siguiente++) < pendientes.size();) {
+      const Corrida &c = pendientes[k];
+      std::string salida;
+      bool ok = ejecutar({cfg.bin, "-i", c.archivo, "-t", cfg.t, "-p", cfg.p,
+                          "-pe", cfg.pe, "-pm", cfg.pm, "-rhoe", cfg.rhoe,
+                          "-seed", cfg.seed, "-dense", cfg.dense},
+                         limite, salida);
+      int valor = 0;
+      if (ok) {
+        auto r = std::from_chars(salida.data(), salida.data() + salida.size(),
+                                 valor);
+        ok = r.ec == std::errc();
+        valor = std::abs(valor);
+      }
+
+      std::lock_guard<std::mutex> lock(mtx);
+      int n = ++terminadas;
+      std::cout << "  [" << n << "/" << pendientes.size() << "] n=" << c.size
+                << " d=" << c.density << " inst=" << c.instance << ": ";
+      if (!ok) {
+        std::cout << "error o timeout (cpu " << cpu << ")\n";
+        continue;
+      }
+      std::cout << valor << " (cpu " << cpu << ")\n";
+      resultados[c.size][{c.density, c.instance}] = valor;
+      salidas[c.size] << c.density << "," << c.instance << "," << valor
+                      << "\n";
+      salidas[c.size].flush();
+    }
+  };
+
+  std::vector<std::thread> hilos;
+  for (int w = 0; w < workers; ++w)
+    hilos.emplace_back(trabajador, w);
+  for (auto &h : hilos)
+    h.join();
+
+  // --- CSV finales ordenados y resumen por densidad ---
+  for (const auto &size : cfg.sizes) {
+    salidas[size].close();
+    escribirResultados(cfg, size, resultados[size]);
+    escribirResumen(cfg, size, resultados[size]);
+  }
+
+  double total = std::chrono::duration<double>(
+                     std::chrono::steady_clock::now() - inicio)
+                     .count();
+  std::cout << "\nPROCESO COMPLETADO en " << total / 60 << " minutos ("
+            << total << " s)\n";
+  return 0;
+}
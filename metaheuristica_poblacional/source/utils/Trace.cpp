@@ -0,0 +1,76 @@
+#include "Trace.h"
+#include <fstream>
+#include <iostream>
+
+static const char *nombreEvento(TipoEvento tipo) {
+  switch (tipo) {
+  case MEJORA:
+    return "mejora";
+  case BARRAKUDA:
+    return "barrakuda";
+  case REINICIO:
+    return "reinicio";
+  case SHAKING:
+    return "shaking";
+  case AJUSTE:
+    return "ajuste";
+  case FIN:
+    return "fin";
+  }
+  return "?";
+}
+
+Trace::Trace(size_t capacidad)
+    : buffer(capacidad), previas(capacidad), total(0),
+      t0(std::chrono::steady_clock::now()) {
+  mejoras.reserve(capacidad);
+}
+
+void Trace::iniciar(std::chrono::steady_clock::time_point t0) {
+  this->t0 = t0;
+  total = 0;
+  mejoras.clear();
+}
+
+bool Trace::volcar(const std::string &archivo, int desplazamiento) const {
+  std::ofstream file(archivo);
+  if (!file.is_open()) {
+    std::cerr << "Error: no se pudo abrir el archivo " << archivo << "\n";
+    return false;
+  }
+
+  bool csv = archivo.size() >= 4 &&
+             archivo.compare(archivo.size() - 4, 4, ".csv") == 0;
+  if (csv)
+    file << "EVENTO,TIEMPO,GENERACION,DECODIFICACIONES,VALOR,EXTRA,FILAS,"
+            "T_MODELO,T_SOLVER,GAP\n";
+
+  auto escribir = [&](const EventoTraza &e) {
+    int valor = e.tipo == AJUSTE ? e.valor : e.valor + desplazamiento;
+    if (csv)
+      file << nombreEvento(e.tipo) << "," << e.t << "," << e.generacion << ","
+           << e.decodificaciones << "," << valor << "," << e.extra << ","
+           << e.filas << "," << e.t_modelo << "," << e.t_solver << ","
+           << e.gap << "\n";
+    else if (e.tipo == MEJORA)
+      file << valor << " " << e.t << "\n";
+  };
+
+  // intercala las mejoras con el resto en el orden en que se registraron
+  size_t cap = buffer.size();
+  size_t desde = total > cap ? total - cap : 0;
+  if (desde > 0)
+    std::cerr << "# traza: se descartaron los " << desde
+              << " eventos mas antiguos (no mejoras)\n";
+  size_t j = 0;
+  for (size_t i = desde; i < total; i++) {
+    for (; j < previas[i % cap]; j++)
+      escribir(mejoras[j]);
+    escribir(buffer[i % cap]);
+  }
+  for (; j < mejoras.size(); j++)
+    escribir(mejoras[j]);
+
+  file.close();
+  return true;
+}
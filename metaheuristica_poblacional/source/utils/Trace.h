@@ -0,0 +1,93 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+// tipos de evento que se registran en la traza any-time
+enum TipoEvento { MEJORA, BARRAKUDA, REINICIO, SHAKING, AJUSTE, FIN };
+
+struct EventoTraza {
+  double t;              // segundos desde el inicio (reloj monotono)
+  TipoEvento tipo;       // que ocurrio
+  int generacion;        // generaciones ejecutadas al momento del evento
+  long decodificaciones; // decodificaciones realizadas al momento del evento
+  int valor;             // mejor fitness (o tamaño de la solucion exacta)
+  int extra;             // dato adicional, ej. |V'| en BARRAKUDA
+                         // (AJUSTE: valor = frecuencia, extra = tope de |V'|)
+  int filas;             // BARRAKUDA: restricciones del modelo exacto
+  double t_modelo;       // BARRAKUDA: segundos construyendo el modelo exacto
+  double t_solver;       // BARRAKUDA: segundos resolviendo (AJUSTE: limite)
+  double gap;            // BARRAKUDA: gap final (0 = optimo, -1 = sin solucion)
+};
+
+/*
+Traza any-time de bajo costo: los eventos se guardan en buffers reservados de
+antemano (registrar no escribe a disco y solo reserva memoria si las mejoras
+superan la capacidad) y se vuelcan una sola vez al terminar. Las mejoras van
+a un buffer propio y nunca se descartan: son los datos de time-to-target. El
+resto de los eventos usa un buffer circular; si superan la capacidad se
+conservan los mas recientes.
+*/
+class Trace {
+public:
+  explicit Trace(size_t capacidad = 4096);
+
+  // fija el instante cero de la traza
+  void iniciar(std::chrono::steady_clock::time_point t0);
+
+  // segundos transcurridos desde iniciar()
+  double segundos() const {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                         t0)
+        .count();
+  }
+
+  void registrar(TipoEvento tipo, int generacion, long decodificaciones,
+                 int valor, int extra = 0) {
+    agregar({segundos(), tipo, generacion, decodificaciones, valor, extra, 0,
+             0.0, 0.0, 0.0});
+  }
+
+  // llamada al solver exacto de BARRAKUDA
+  void registrarExacto(int generacion, long decodificaciones, int valor,
+                       int nodos, int filas, double t_modelo, double t_solver,
+                       double gap) {
+    agregar({segundos(), BARRAKUDA, generacion, decodificaciones, valor, nodos,
+             filas, t_modelo, t_solver, gap});
+  }
+
+  // decision del control adaptativo de BARRAKUDA: generaciones entre
+  // llamadas, tope de |V'| y tiempo limite por llamada
+  void registrarAjuste(int generacion, long decodificaciones, int frecuencia,
+                       int tope_vprime, double limite) {
+    agregar({segundos(), AJUSTE, generacion, decodificaciones, frecuencia,
+             tope_vprime, 0, 0.0, limite, 0.0});
+  }
+
+  // escribe la traza en archivo. Si termina en .csv se escriben todos los
+  // eventos en CSV; si no, solo las mejoras como lineas "valor tiempo"
+  // (mismo formato que meta_sa). desplazamiento se suma a los tamaños de
+  // solucion (ej. nodos fijados por el kernel)
+  bool volcar(const std::string &archivo, int desplazamiento = 0) const;
+
+private:
+  void agregar(const EventoTraza &e) {
+    if (e.tipo == MEJORA) {
+      mejoras.push_back(e);
+      return;
+    }
+    buffer[total % buffer.size()] = e;
+    previas[total % buffer.size()] = mejoras.size();
+    total++;
+  }
+
+  std::vector<EventoTraza> mejoras; // todas las MEJORA, en orden
+  std::vector<EventoTraza> buffer;  // el resto, circular
+  std::vector<size_t> previas; // mejoras registradas antes de buffer[i]
+  size_t total; // eventos del buffer registrados (puede superar la capacidad)
+  std::chrono::steady_clock::time_point t0;
+};
+
+#endif